@@ -7,11 +7,139 @@
 #include <limits>
 #include <sstream>
 #include <set>
+#include <map>
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <charconv>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <bitset>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <new>
+#include <cstdlib>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/un.h>
+#else
+#include <io.h>
+#endif
 
 using namespace std;
 
+// ==========================
+// SYMBOLS
+// ==========================
+// Emails, event names, venue IDs and ticket types repeat across every
+// ticket, booth and session, so records keep a 32-bit handle into one
+// table of distinct values. Equal handles mean equal text. Values are
+// never removed, and a handle's text never moves once interned, so readers
+// need no lock: a handle only reaches a thread after its text was written.
+class SymbolTable {
+public:
+    static const uint32_t ABSENT = UINT32_MAX; // matches no interned value
+
+    SymbolTable() { intern(""); } // handle 0 is the empty string
+
+    uint32_t intern(string_view text) {
+        lock_guard<mutex> lock(tableMutex);
+        auto found = index.find(text);
+        if (found != index.end()) return found->second;
+        uint32_t id = count;
+        if (id == ABSENT || (id >> CHUNK_BITS) >= MAX_CHUNKS) throw length_error("symbol table full");
+        unique_ptr<string[]>& chunk = chunks[id >> CHUNK_BITS];
+        if (!chunk) chunk.reset(new string[CHUNK_SIZE]);
+        string& slot = chunk[id & (CHUNK_SIZE - 1)];
+        slot.assign(text.data(), text.size());
+        index.emplace(slot, id);
+        count = id + 1;
+        return id;
+    }
+
+    // The handle of text already interned, or ABSENT; never adds a value
+    uint32_t find(string_view text) const {
+        lock_guard<mutex> lock(tableMutex);
+        auto found = index.find(text);
+        return found == index.end() ? ABSENT : found->second;
+    }
+
+    const string& text(uint32_t id) const {
+        static const string none;
+        return id == ABSENT ? none : chunks[id >> CHUNK_BITS][id & (CHUNK_SIZE - 1)];
+    }
+
+    size_t size() const {
+        lock_guard<mutex> lock(tableMutex);
+        return count;
+    }
+
+private:
+    static const uint32_t CHUNK_BITS = 16;
+    static const uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+    static const uint32_t MAX_CHUNKS = 1u << 12;
+
+    mutable mutex tableMutex; // a plain mutex: interning is mostly short hits
+    unique_ptr<string[]> chunks[MAX_CHUNKS];
+    unordered_map<string_view, uint32_t> index; // views into the chunks
+    uint32_t count = 0;
+};
+
+SymbolTable symbols;
+
+// A record field holding an interned value. It reads as the string it
+// stands for, and compares to another Symbol as an integer.
+struct Symbol {
+    uint32_t id = 0;
+
+    Symbol() = default;
+    Symbol(string_view text) : id(symbols.intern(text)) {}
+    Symbol(const string& text) : id(symbols.intern(text)) {}
+    Symbol(const char* text) : id(symbols.intern(text)) {}
+
+    // For comparisons: the handle of text, without interning it
+    static Symbol existing(string_view text) {
+        Symbol s;
+        s.id = symbols.find(text);
+        return s;
+    }
+
+    const string& str() const { return symbols.text(id); }
+    operator const string&() const { return str(); }
+    bool empty() const { return id == 0; }
+    size_t size() const { return str().size(); }
+};
+
+bool operator==(Symbol a, Symbol b) { return a.id == b.id; }
+bool operator!=(Symbol a, Symbol b) { return a.id != b.id; }
+bool operator==(Symbol a, const string& b) { return a.str() == b; }
+bool operator!=(Symbol a, const string& b) { return a.str() != b; }
+bool operator==(const string& a, Symbol b) { return a == b.str(); }
+bool operator!=(const string& a, Symbol b) { return a != b.str(); }
+bool operator==(Symbol a, const char* b) { return a.str() == b; }
+bool operator!=(Symbol a, const char* b) { return a.str() != b; }
+bool operator<(Symbol a, Symbol b) { return a.str() < b.str(); }
+
+ostream& operator<<(ostream& out, Symbol s) { return out << s.str(); }
+
 // ==========================
 // STRUCT DEFINITIONS
 // ==========================
@@ -64,13 +192,14 @@ struct TicketType {
     double price;
     int capacity;
     int sold;
+    double revenue = 0;
 };
 
 struct Ticket {
-    string userEmail;
+    Symbol userEmail;
     string ticketID;
-    string eventName;
-    string ticketType;
+    Symbol eventName;
+    Symbol ticketType;
     double amount;
 };
 
@@ -81,8 +210,8 @@ struct BoothType {
 };
 
 struct Booth {
-    string userEmail;
-    string venueID;
+    Symbol userEmail;
+    Symbol venueID;
     string boothID;
     double amount;
     bool isRented;
@@ -96,412 +225,1435 @@ struct Venue {
     vector<TicketType> ticketType;
     vector<BoothType> boothType;
     bool isAvailable;
+    int boothsRented = 0;
+    double boothRevenue = 0;
 };
 
 struct Session {
     string sessionID;
-    string venueID;
-    string exhibitorEmail;
+    Symbol venueID;
+    Symbol exhibitorEmail;
     string topic;
     string timeSlot;
 };
 
 // ==========================
-// HELPER FUNCTIONS
+// INSTRUMENTATION
 // ==========================
-void clearInputBuffer() {
-    cin.clear();
-    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+// Scoped timers and byte counters around the load/save paths, the file
+// layer and the busiest handlers. Collection is off unless EXPO_STATS is set
+// at startup or an admin turns it on; while off a timer is one flag check.
+bool statsEnabled = false;
+
+// Group commit totals (see DURABILITY) and when counting started
+atomic<uint64_t> walCommits{0};
+atomic<uint64_t> walCommittedRecords{0};
+chrono::steady_clock::time_point statsSince = chrono::steady_clock::now();
+
+struct StatEntry {
+    string name;
+    atomic<uint64_t> count{0};
+    atomic<uint64_t> totalNs{0};
+    atomic<uint64_t> maxNs{0};
+    atomic<uint64_t> bytesRead{0};
+    atomic<uint64_t> bytesWritten{0};
+};
+
+deque<StatEntry>& statEntries() {
+    static deque<StatEntry> entries; // a deque never moves its elements
+    return entries;
 }
 
-bool isValidEmail(const string &email) {
-    const regex pattern(R"(^[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Za-z]{2,}$)");
-    return regex_match(email, pattern);
+mutex& statMutex() {
+    static mutex m;
+    return m;
 }
 
-int getValidatedChoice(int min, int max, string prompt) {
-    int choice;
-    while (true) {
-        cout << prompt;
-        if (!(cin >> choice)) {
-            // Input is not an integer
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid input. Please enter a number between " << min << " and " << max << ".\n\n";
-            continue;
-        }
+// Call sites register once through a function-local static; sites sharing
+// a name share an entry
+StatEntry& registerStat(const string& name) {
+    lock_guard<mutex> lock(statMutex());
+    for (auto& entry : statEntries()) {
+        if (entry.name == name) return entry;
+    }
+    statEntries().emplace_back();
+    statEntries().back().name = name;
+    return statEntries().back();
+}
 
-        if (choice < min || choice > max) {
-            cout << "Invalid choice. Please enter a number between " << min << " and " << max << ".\n\n";
-            continue;
-        }
+class ScopedTimer {
+public:
+    explicit ScopedTimer(StatEntry& entry) : entry(entry), active(statsEnabled) {
+        if (active) start = chrono::steady_clock::now();
+    }
 
-        cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Clear leftover newline
-        return choice;
+    ~ScopedTimer() {
+        if (!active) return;
+        uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        entry.count.fetch_add(1, memory_order_relaxed);
+        entry.totalNs.fetch_add(ns, memory_order_relaxed);
+        uint64_t prev = entry.maxNs.load(memory_order_relaxed);
+        while (ns > prev && !entry.maxNs.compare_exchange_weak(prev, ns, memory_order_relaxed)) {}
     }
-}
 
-string generateUserID(const string &filename, char prefix) {
-    ifstream inFile(filename);
-    string line;
-    int maxNum = 0;
+    void read(size_t bytes) {
+        if (active) entry.bytesRead.fetch_add(bytes, memory_order_relaxed);
+    }
+    void wrote(size_t bytes) {
+        if (active) entry.bytesWritten.fetch_add(bytes, memory_order_relaxed);
+    }
 
-    while (getline(inFile, line)) {
-        size_t pos = line.find(',');
-        if (pos != string::npos) {
-            string id = line.substr(0, pos); // first field is always ID
-            if (id[0] == prefix) {
-                try {
-                    int num = stoi(id.substr(1)); // skip prefix
-                    if (num > maxNum) maxNum = num; // keep track of largest number
-                } catch (...) {
-                    // ignore malformed IDs
-                }
-            }
-        }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    StatEntry& entry;
+    bool active;
+    chrono::steady_clock::time_point start;
+};
+
+#define STAT_TIMER(var, name) \
+    static StatEntry& var##Entry = registerStat(name); \
+    ScopedTimer var(var##Entry)
+
+void printStats(ostream& out) {
+    vector<const StatEntry*> rows;
+    {
+        lock_guard<mutex> lock(statMutex());
+        for (const auto& entry : statEntries()) {
+            if (entry.count.load() > 0) rows.push_back(&entry);
+        }
+    }
+    sort(rows.begin(), rows.end(), [](const StatEntry* a, const StatEntry* b) {
+        return a->totalNs.load() > b->totalNs.load();
+    });
+
+    out << left << setw(26) << "operation" << right << setw(9) << "count" << setw(12) << "total ms"
+        << setw(11) << "avg us" << setw(11) << "max us" << setw(12) << "read KB" << setw(12) << "written KB" << "\n";
+    out << string(93, '-') << "\n";
+    for (const StatEntry* e : rows) {
+        uint64_t count = e->count.load();
+        out << left << setw(26) << e->name << right << setw(9) << count << fixed
+            << setprecision(2) << setw(12) << e->totalNs.load() / 1e6
+            << setprecision(1) << setw(11) << e->totalNs.load() / 1e3 / count
+            << setw(11) << e->maxNs.load() / 1e3
+            << setw(12) << e->bytesRead.load() / 1024.0
+            << setw(12) << e->bytesWritten.load() / 1024.0 << "\n";
+    }
+    if (rows.empty()) out << "No operations recorded yet.\n";
+
+    uint64_t commits = walCommits.load();
+    if (commits > 0) {
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - statsSince).count();
+        out << "\nGroup commit: " << commits << " fsyncs, " << fixed << setprecision(1)
+            << commits / max(seconds, 1e-9) << " commits/s, " << setprecision(2)
+            << double(walCommittedRecords.load()) / commits << " records per commit\n";
+    }
+}
+
+void resetStats() {
+    lock_guard<mutex> lock(statMutex());
+    walCommits = 0;
+    walCommittedRecords = 0;
+    statsSince = chrono::steady_clock::now();
+    for (auto& e : statEntries()) {
+        e.count = 0;
+        e.totalNs = 0;
+        e.maxNs = 0;
+        e.bytesRead = 0;
+        e.bytesWritten = 0;
     }
-    inFile.close();
+}
 
-    // Generate next ID
-    int nextNum = maxNum + 1;
-    stringstream ss;
-    ss << prefix << setw(3) << setfill('0') << nextNum;
-    return ss.str();
+// ==========================
+// CROSS-PROCESS LOCKING
+// ==========================
+// Several copies of the program may share one data directory, one per
+// kiosk. A copy holds an advisory flock on expo.lock for one store
+// operation at a time (check, change, log) and never across a prompt; a
+// server lets it linger for a few milliseconds, see below.
+// expo.gen keeps a generation number per data file, and releasing the lock
+// bumps the ones the operation wrote. Each copy remembers the generations
+// its resident collections were loaded at, so an operation can tell which
+// of the collections it reads are stale and reload only those.
+const string STORE_LOCK_FILE = "expo.lock";
+const string GENERATION_FILE = "expo.gen";
+
+// The lock is taken once per process; threads of the server share it
+mutex fileLockMutex;
+int fileLockHolders = 0;
+bool fileLockHeld = false;              // the flock, which may outlast its holders
+bool generationsRead = false;           // fileGenerations read under the current lock
+map<string, uint64_t> fileGenerations;  // as of the last read, plus this copy's bumps
+set<string> filesWritten;               // by the operations under the current lock
+bool generationsPending = false;        // bumps not yet written to expo.gen
+#ifndef _WIN32
+int fileLockFd = -1;
+#endif
+
+// While sales run concurrently the lock lingers after its last holder
+// leaves: the flock stays held and the generation bumps stay in memory, so
+// back-to-back requests neither flock nor rewrite expo.gen. A releaser
+// thread hands the lock back once it has been idle for STORE_LOCK_LINGER,
+// and an unlock hands it back once it has been held for STORE_LOCK_MAX_HOLD,
+// so other copies wait about that long at most. The first write of a hold
+// puts every lingering file one generation ahead in expo.gen, so if this
+// copy dies holding the lock, the next one reloads whatever it may have
+// written.
+const chrono::milliseconds STORE_LOCK_LINGER(2);
+const chrono::milliseconds STORE_LOCK_MAX_HOLD(20);
+bool lingerStoreLock = false;
+vector<string> lingerFiles;
+chrono::steady_clock::time_point fileLockHeldSince, fileLockIdleSince;
+bool lockReleaserStopping = false;
+condition_variable lockReleaserWake;
+thread lockReleaserThread;
+
+void replaceFile(const string& source, const string& target, bool durable = true);
+void generationsCommitted(const set<string>& files, const map<string, uint64_t>& before);
+
+map<string, uint64_t> readGenerations() {
+    map<string, uint64_t> generations;
+    ifstream file(GENERATION_FILE);
+    string filename;
+    uint64_t generation;
+    while (file >> filename >> generation) generations[filename] = generation;
+    return generations;
 }
 
-bool isDigits(const string &s) {
-    return !s.empty() && all_of(s.begin(), s.end(), ::isdigit);
+void writeGenerations(const map<string, uint64_t>& generations) {
+    ofstream out(GENERATION_FILE + ".tmp", ios::trunc);
+    for (const auto& entry : generations) out << entry.first << " " << entry.second << "\n";
+    out.close();
+    // Only running copies read it, and a crash that loses it takes them all down
+    replaceFile(GENERATION_FILE + ".tmp", GENERATION_FILE, false);
 }
 
-bool isValidBoothID(const Venue& venue, const string& boothID) {
-    if (boothID.length() < 2 || !isDigits(boothID.substr(1))) {
-        return false;
-    }
-    char col = toupper(boothID[0]);
-    int row = 0;
-    try { row = stoi(boothID.substr(1)); } catch (...) { return false; }
-    if (col < 'A' || col >= 'A' + venue.columns) return false;
-    if (row < 1 || row > venue.rows) return false;
-    return true;
+// Re-entrant. Windows builds have no flock and skip the file lock, so run
+// one copy per data directory there.
+void lockStoreFiles() {
+    lock_guard<mutex> lock(fileLockMutex);
+    if (fileLockHolders++ > 0 || fileLockHeld) return;
+#ifndef _WIN32
+    // Opened per lock, as the benchmarks change directory between runs,
+    // and kept open while the lock lingers
+    if (fileLockFd < 0) fileLockFd = open(STORE_LOCK_FILE.c_str(), O_RDWR | O_CREAT, 0644);
+    while (fileLockFd >= 0 && flock(fileLockFd, LOCK_EX) != 0 && errno == EINTR) {}
+#endif
+    fileLockHeld = true;
+    fileLockHeldSince = chrono::steady_clock::now();
+    generationsRead = false;
 }
 
-string generateTicketID(const vector<Ticket>& tickets) {
-    int maxID = 0;
-    for (const auto& t : tickets) {
-        if (t.ticketID.size() > 1 && t.ticketID[0] == 'T') {
-            try {
-                int num = stoi(t.ticketID.substr(1));
-                if (num > maxID) maxID = num;
-            } catch (...) {}
-        }
+// Call with fileLockMutex held and no holders left
+void releaseFileLock() {
+    if (generationsPending) writeGenerations(fileGenerations);
+    generationsPending = false;
+#ifndef _WIN32
+    if (lingerStoreLock && fileLockFd >= 0) {
+        flock(fileLockFd, LOCK_UN);
+    } else {
+        if (fileLockFd >= 0) close(fileLockFd); // drops the flock
+        fileLockFd = -1;
     }
-    return "T" + to_string(maxID + 1);
+#endif
+    fileLockHeld = false;
 }
 
-string generateSessionID() {
-    ifstream file("sessions.txt");
-    int maxID = 0;
+void unlockStoreFiles() {
+    lock_guard<mutex> lock(fileLockMutex);
+    if (--fileLockHolders > 0) return;
+    if (!filesWritten.empty()) {
+        map<string, uint64_t> before = generationsRead ? fileGenerations : readGenerations();
+        fileGenerations = before;
+        for (const auto& filename : filesWritten) fileGenerations[filename]++;
+        generationsRead = true;
+        if (lingerStoreLock && !generationsPending) {
+            map<string, uint64_t> ahead = fileGenerations;
+            for (const auto& filename : lingerFiles) ahead[filename] = max(ahead[filename], before[filename] + 1);
+            writeGenerations(ahead);
+        }
+        generationsPending = true;
+        generationsCommitted(filesWritten, before);
+        filesWritten.clear();
+    }
+    auto now = chrono::steady_clock::now();
+    if (lingerStoreLock && now - fileLockHeldSince < STORE_LOCK_MAX_HOLD) {
+        fileLockIdleSince = now;
+        return;
+    }
+    releaseFileLock();
+}
 
-    if (file.is_open()) {
-        string line;
-        while (getline(file, line)) {
-            stringstream ss(line);
-            string id;
-            getline(ss, id, ','); // sessionID is the first field
-
-            if (!id.empty() && id[0] == 'S') {
-                try {
-                    int num = stoi(id.substr(1)); // remove 'S' and convert to int
-                    if (num > maxID) {
-                        maxID = num;
-                    }
-                } catch (...) {
-                    // ignore malformed IDs
-                }
+// files: every data file the lingering copy may write
+void startLingeringStoreLock(const vector<string>& files) {
+    lock_guard<mutex> lock(fileLockMutex);
+    lingerStoreLock = true;
+    lingerFiles = files;
+    lockReleaserStopping = false;
+    lockReleaserThread = thread([] {
+        unique_lock<mutex> lock(fileLockMutex);
+        while (!lockReleaserStopping) {
+            lockReleaserWake.wait_for(lock, STORE_LOCK_LINGER);
+            if (fileLockHeld && fileLockHolders == 0 &&
+                chrono::steady_clock::now() - fileLockIdleSince >= STORE_LOCK_LINGER) {
+                releaseFileLock();
             }
         }
-        file.close();
-    }
+    });
+}
+
+// Hands back a lingering lock and closes the lock file
+void stopLingeringStoreLock() {
+    {
+        lock_guard<mutex> lock(fileLockMutex);
+        lockReleaserStopping = true;
+        lockReleaserWake.notify_all();
+    }
+    lockReleaserThread.join();
+    lock_guard<mutex> lock(fileLockMutex);
+    lingerStoreLock = false;
+    if (fileLockHeld && fileLockHolders == 0) releaseFileLock();
+#ifndef _WIN32
+    if (!fileLockHeld && fileLockFd >= 0) {
+        close(fileLockFd);
+        fileLockFd = -1;
+    }
+#endif
+}
+
+struct StoreFileLock {
+    StoreFileLock() { lockStoreFiles(); }
+    ~StoreFileLock() { unlockStoreFiles(); }
+    StoreFileLock(const StoreFileLock&) = delete;
+    StoreFileLock& operator=(const StoreFileLock&) = delete;
+};
 
-    return "S" + to_string(maxID + 1);
+// Call with the store files locked
+void noteFileWrite(const string& filename) {
+    lock_guard<mutex> lock(fileLockMutex);
+    filesWritten.insert(filename);
 }
 
-int timeToInt(const string& t) {
-    int hours = stoi(t.substr(0, 2));
-    int mins = stoi(t.substr(3, 2));
-    return hours * 100 + mins;
+// Generations on disk, read once per lock: nobody else can change them
+// until it is released. Call with the store files locked.
+uint64_t diskGeneration(const string& filename) {
+    lock_guard<mutex> lock(fileLockMutex);
+    if (!generationsRead) {
+        fileGenerations = readGenerations();
+        generationsRead = true;
+    }
+    auto it = fileGenerations.find(filename);
+    return it == fileGenerations.end() ? 0 : it->second;
 }
 
-bool isValidTimeSlot(const string& slot) {
-    regex pattern(R"(^\d{2}:\d{2}-\d{2}:\d{2}$)");
-    if (!regex_match(slot, pattern)) return false;
+// ==========================
+// DURABILITY
+// ==========================
+// Log records are made durable with fsync, and whole-file rewrites go to a
+// temp file that is synced before it is renamed over the original. One
+// fsync covers every record written before it starts, so commits are
+// grouped; commitMode says who waits for them:
+//  - COMMIT_EACH_WRITE (menus): walWrite returns once its records are on disk.
+//  - COMMIT_BEFORE_REPLY (server): a command logs as it goes and calls
+//    commitWal before replying, so clients served at the same time share
+//    an fsync. The thread leading a commit waits up to the commit window
+//    for threads that have logged but not yet asked to commit.
+//  - COMMIT_IN_BACKGROUND (batch): nobody waits. A committer thread syncs
+//    whatever was logged once per window, so a record is on disk at most
+//    one window after it was written.
+// EXPO_COMMIT_WINDOW_MS sets the window (default 2; 0 disables the wait).
+enum CommitMode { COMMIT_EACH_WRITE, COMMIT_BEFORE_REPLY, COMMIT_IN_BACKGROUND };
+
+CommitMode commitMode = COMMIT_EACH_WRITE;
+chrono::microseconds commitWindow(2000);
+
+mutex commitMutex;
+condition_variable commitChanged;
+uint64_t walWrittenRecords = 0;  // since startup
+uint64_t walSyncedRecords = 0;   // of those, known to be on disk
+bool walSyncing = false;
+int commitsPending = 0;          // threads that logged and have not committed
+int commitsWaiting = 0;          // of those, threads inside commitWal
+thread_local uint64_t threadWalRecords = 0;
+thread_local bool threadCommitPending = false;
+
+thread committerThread;
+bool committerStopping = false;
+
+const string WAL_FILE = "expo.wal";
+
+void syncPath(const string& path) {
+#ifdef _WIN32
+    FILE* file = fopen(path.c_str(), "rb+");
+    if (!file) return;
+    _commit(_fileno(file));
+    fclose(file);
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+    close(fd);
+#endif
+}
 
-    string startStr = slot.substr(0, 5);
-    string endStr   = slot.substr(6, 5);
+// Makes renames and removals in the data directory durable. Windows
+// commits directory entries itself.
+void syncDirectory() {
+#ifndef _WIN32
+    syncPath(".");
+#endif
+}
 
-    int sh = stoi(startStr.substr(0, 2));
-    int sm = stoi(startStr.substr(3, 2));
-    int eh = stoi(endStr.substr(0, 2));
-    int em = stoi(endStr.substr(3, 2));
+// Called by walWrite with walMutex held, once count records are written
+void walRecordsWritten(size_t count) {
+    lock_guard<mutex> lock(commitMutex);
+    walWrittenRecords += count;
+    threadWalRecords = walWrittenRecords;
+    if (commitMode != COMMIT_IN_BACKGROUND && !threadCommitPending) {
+        threadCommitPending = true;
+        commitsPending++;
+    }
+}
 
-    // Hours/minutes range check
-    if (sh < 0 || sh > 23 || eh < 0 || eh > 23) return false;
-    if (sm < 0 || sm > 59 || em < 0 || em > 59) return false;
+// A checkpoint folds the log into synced files, so every record in it is durable
+void walCheckpointed() {
+    lock_guard<mutex> lock(commitMutex);
+    walSyncedRecords = walWrittenRecords;
+    commitChanged.notify_all();
+}
 
-    // Start must be before end
-    return timeToInt(startStr) < timeToInt(endStr);
+// One fsync for everything logged so far. Call with commitMutex held in lock.
+void leadCommit(unique_lock<mutex>& lock) {
+    walSyncing = true;
+    if (commitWindow.count() > 0 && commitsWaiting < commitsPending) {
+        commitChanged.wait_for(lock, commitWindow, [] { return commitsWaiting >= commitsPending; });
+    }
+    uint64_t target = walWrittenRecords;
+    lock.unlock();
+    {
+        STAT_TIMER(timer, "wal fsync");
+        syncPath(WAL_FILE);
+    }
+    lock.lock();
+    if (target > walSyncedRecords) {
+        walCommits++;
+        walCommittedRecords += target - walSyncedRecords;
+        walSyncedRecords = target;
+    }
+    walSyncing = false;
+    commitChanged.notify_all();
 }
 
-bool isOverlap(const string& slot1, const string& slot2) {
-    // Expect format "HH:MM-HH:MM"
-    int start1 = timeToInt(slot1.substr(0, 5));
-    int end1   = timeToInt(slot1.substr(6, 5));
+// Returns once every record this thread logged is on disk
+void commitWal() {
+    if (!threadCommitPending) return;
+    unique_lock<mutex> lock(commitMutex);
+    commitsWaiting++;
+    commitChanged.notify_all(); // a leader may be waiting for this thread
+    while (walSyncedRecords < threadWalRecords) {
+        if (walSyncing) commitChanged.wait(lock);
+        else leadCommit(lock);
+    }
+    commitsWaiting--;
+    commitsPending--;
+    threadCommitPending = false;
+}
 
-    int start2 = timeToInt(slot2.substr(0, 5));
-    int end2   = timeToInt(slot2.substr(6, 5));
+void startBackgroundCommits() {
+    commitMode = COMMIT_IN_BACKGROUND;
+    committerStopping = false;
+    committerThread = thread([] {
+        unique_lock<mutex> lock(commitMutex);
+        while (!committerStopping) {
+            commitChanged.wait_for(lock, max(commitWindow, chrono::microseconds(100)));
+            if (walSyncedRecords < walWrittenRecords && !walSyncing) leadCommit(lock);
+        }
+    });
+}
 
-    return (start1 < end2 && start2 < end1);
+// Stops the committer and syncs what it had not reached yet
+void stopBackgroundCommits() {
+    {
+        lock_guard<mutex> lock(commitMutex);
+        committerStopping = true;
+        commitChanged.notify_all();
+    }
+    committerThread.join();
+    unique_lock<mutex> lock(commitMutex);
+    while (walSyncing) commitChanged.wait(lock);
+    if (walSyncedRecords < walWrittenRecords) leadCommit(lock);
+    commitMode = COMMIT_EACH_WRITE;
 }
 
 // ==========================
-// FILE HANDLING
+// WRITE-AHEAD LOG
 // ==========================
-void loadCredentials(vector<UserCredential> &credentials) {
-    credentials.clear();
-
-    string line;
+// Every mutation is appended to expo.wal as a small record instead of
+// rewriting the whole data file. A delete is a tombstone: a record naming
+// the line it retires, which stays in the base file until compaction.
+// Loads replay the pending records on top of the base file, and a
+// checkpoint compacts the log back into the files once some store's dead
+// records reach COMPACT_DEAD_RATIO of its records, or the log grows to
+// WAL_CHECKPOINT_RECORDS line records.
+const string CHECKPOINT_MANIFEST = "expo.ckpt";
+const size_t WAL_CHECKPOINT_RECORDS = 5000; // bounds replay when few lines die
+const double COMPACT_DEAD_RATIO = 0.25;
+const size_t COMPACT_MIN_DEAD = 32;         // so a small file is not rewritten for each delete
+const char WAL_FIELD_SEP = '\x1f';
+
+struct WalRecord {
+    char op;        // 'A' = append line, 'D' = delete line, 'R' = replace line,
+                    // 'V' = set sales counters in the venue file,
+                    // 'B' = begin a unit, payload = the number of records in it
+    string file;
+    string payload; // for 'R': old line + WAL_FIELD_SEP + new line
+                    // for 'V': counter key + WAL_FIELD_SEP + values, see venueStatsKey
+};
 
-    // ===== Load Attendees =====
-    ifstream inFile("attendees.txt");
-    if (!inFile.is_open()) {
-        cout << "Could not open attendees.txt" << endl;
-    } else {
-        while (getline(inFile, line)) {
-            stringstream ss(line);
-            string id, name, email, password;
+size_t walPendingRecords = 0;
+size_t walPendingVenueRecords = 0;
 
-            if (getline(ss, id, ',') &&
-                getline(ss, name, ',') &&
-                getline(ss, email, ',') &&
-                getline(ss, password)) 
-            {
-                credentials.push_back({email, password, "Attendee"});
-            }
-        }
-        inFile.close();
+// Per data file since the last compaction: the lines it holds now and the
+// lines tombstoned by deletes and replaces. Set when the file is loaded
+// and kept up to date by walWrite. Guarded by walMutex.
+struct StoreLiveness {
+    size_t live = 0;
+    size_t dead = 0;
+};
+map<string, StoreLiveness> storeLiveness;
+
+// Log appends may come from several sales threads at once. While sales run
+// concurrently a checkpoint cannot run inside walWrite, since other threads
+// are still changing memory, so walWrite only marks it due for the
+// compactor thread; see startBackgroundCompaction.
+mutex walMutex;
+bool deferCheckpoints = false;
+atomic<bool> checkpointDue(false);
+
+// Wakes the compactor thread; see startBackgroundCompaction
+mutex compactorMutex;
+condition_variable compactionWanted;
+
+void checkpointStores();
+void applyVenueWalRecord(const WalRecord& r);
+bool renderResidentStore(const string& filename, vector<string>& lines);
+void clearDirtyCollections();
+
+string walChecksum(const WalRecord& r) {
+    // FNV-1a over the record so torn or corrupted tails are detected on replay
+    uint32_t hash = 2166136261u;
+    string data = string(1, r.op) + "|" + r.file + "|" + r.payload;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 16777619u;
     }
+    stringstream ss;
+    ss << hex << setw(8) << setfill('0') << hash;
+    return ss.str();
+}
 
-    // ===== Load Exhibitors =====
-    inFile.open("exhibitors.txt");
-    if (!inFile.is_open()) {
-        cout << "Could not open exhibitors.txt" << endl;
-    } else {
-        while (getline(inFile, line)) {
-            stringstream ss(line);
-            string id, companyName, email, password;
+string encodeWalRecord(const WalRecord& r) {
+    return string(1, r.op) + "|" + r.file + "|" + walChecksum(r) + "|" + r.payload + "\n";
+}
 
-            if (getline(ss, id, ',') &&
-                getline(ss, companyName, ',') &&
-                getline(ss, email, ',') &&
-                getline(ss, password)) 
-            {
-                credentials.push_back({email, password, "Exhibitor"});
-            }
-        }
-        inFile.close();
-    }
+bool decodeWalRecord(const string& line, WalRecord& r) {
+    size_t pos1 = line.find('|');
+    if (pos1 != 1) return false;
+    size_t pos2 = line.find('|', pos1 + 1);
+    if (pos2 == string::npos) return false;
+    size_t pos3 = line.find('|', pos2 + 1);
+    if (pos3 == string::npos) return false;
+
+    r.op = line[0];
+    r.file = line.substr(pos1 + 1, pos2 - pos1 - 1);
+    r.payload = line.substr(pos3 + 1);
+    if (r.op != 'A' && r.op != 'D' && r.op != 'R' && r.op != 'V' && r.op != 'B') return false;
+    return walChecksum(r) == line.substr(pos2 + 1, pos3 - pos2 - 1);
+}
 
-    // ===== Load Admins =====
-    inFile.open("admins.txt");
-    if (!inFile.is_open()) {
-        cout << "Could not open admins.txt" << endl;
-    } else {
-        while (getline(inFile, line)) {
-            stringstream ss(line);
-            string email, password;
+// Identifies one version of a data file. Checkpoints replace the files by
+// renaming a new one over them, which changes the inode as well.
+struct FileStamp {
+    uint64_t size = 0;
+    int64_t modified = 0;
+    uint64_t inode = 0;
+};
 
-            if (getline(ss, email, ',') &&
-                getline(ss, password)) 
-            {
-                credentials.push_back({email, password, "Admin"});
-            }
+FileStamp fileStamp(const string& filename) {
+    FileStamp stamp;
+    error_code error;
+    uintmax_t size = filesystem::file_size(filename, error);
+    if (error) return stamp;
+    stamp.size = size;
+    stamp.modified = filesystem::last_write_time(filename, error).time_since_epoch().count();
+#ifndef _WIN32
+    struct stat info;
+    if (stat(filename.c_str(), &info) == 0) stamp.inode = info.st_ino;
+#endif
+    return stamp;
+}
+
+bool operator==(const FileStamp& a, const FileStamp& b) {
+    return a.size == b.size && a.modified == b.modified && a.inode == b.inode;
+}
+
+// The records of one operation are framed as a unit by a leading 'B'
+// record, so a crash never keeps some of them without the rest. A record
+// outside any unit stands alone. validBytes, if given, gets the length of
+// the log up to the end of the last complete unit.
+vector<WalRecord> readWal(uint64_t* validBytes = nullptr) {
+    STAT_TIMER(timer, "wal read");
+    vector<WalRecord> records;
+    ifstream wal(WAL_FILE, ios::binary);
+    string line;
+    uint64_t bytes = 0, complete = 0;
+    size_t unitLeft = 0, unitStart = 0;
+    while (getline(wal, line) && !wal.eof()) {
+        WalRecord r;
+        if (!decodeWalRecord(line, r)) break; // torn tail from a crash, ignore the rest
+        if (r.op == 'B') {
+            size_t count = 0;
+            auto parsed = from_chars(r.payload.data(), r.payload.data() + r.payload.size(), count);
+            if (unitLeft > 0 || parsed.ec != errc() || count == 0) break;
+            unitLeft = count;
+            unitStart = records.size();
+        } else {
+            records.push_back(r);
+            if (unitLeft > 0) unitLeft--;
         }
-        inFile.close();
+        bytes += line.size() + 1;
+        if (unitLeft == 0) complete = bytes;
     }
+    if (unitLeft > 0) records.resize(unitStart); // the unit was cut short
+    timer.read(complete);
+    if (validBytes) *validBytes = complete;
+    return records;
 }
 
-Attendee findAttendee(string email) {
-    Attendee foundAttendee;
+// The log as last read. Every collection that loads replays the same log,
+// so it is read again only once the file has changed: an append from any
+// copy of the program, or a checkpoint. Shared, as a load may still be
+// replaying the previous version.
+mutex walCacheMutex;
+shared_ptr<const vector<WalRecord>> walCache;
+FileStamp walCacheStamp;
+
+// Stamped before reading, so an append that races the read only makes the
+// next call read again
+shared_ptr<const vector<WalRecord>> loggedRecords() {
+    FileStamp stamp = fileStamp(WAL_FILE);
+    lock_guard<mutex> lock(walCacheMutex);
+    if (!walCache || !(stamp == walCacheStamp)) {
+        walCache = make_shared<const vector<WalRecord>>(readWal());
+        walCacheStamp = stamp;
+    }
+    return walCache;
+}
 
-    ifstream inFile("attendees.txt");
+void cacheLoggedRecords(vector<WalRecord> records) {
+    FileStamp stamp = fileStamp(WAL_FILE);
+    lock_guard<mutex> lock(walCacheMutex);
+    walCache = make_shared<const vector<WalRecord>>(move(records));
+    walCacheStamp = stamp;
+}
 
-    string line;
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        Attendee a;
-        getline(ss, a.id, ',');
-        getline(ss, a.name, ',');
-        getline(ss, a.email, ',');
-        getline(ss, a.password, ',');
+void applyVenueWalRecord(const WalRecord& r);
 
-        if(a.email == email) {
-            foundAttendee = a;
+// Counts a line record against its file. Returns true once the file's dead
+// lines reach the compaction ratio. Call with walMutex held.
+bool noteLineRecord(const WalRecord& r) {
+    StoreLiveness& s = storeLiveness[r.file];
+    if (r.op == 'A') {
+        s.live++;
+        return false;
+    }
+    s.dead++;
+    if (r.op == 'D' && s.live > 0) s.live--;
+    return s.dead >= COMPACT_MIN_DEAD && s.dead >= COMPACT_DEAD_RATIO * (s.live + s.dead);
+}
+
+// Records what a load found, so the ratio covers records other copies logged
+void noteStoreLoaded(const string& filename, size_t live, size_t dead) {
+    lock_guard<mutex> lock(walMutex);
+    storeLiveness[filename] = {live, dead};
+}
+
+// counter, if given, builds one more counter record while the log is held
+// and the record is applied to venues.dat before the log is released. Used
+// for counters read from atomics, so the last value logged is the newest.
+void walWrite(const vector<WalRecord>& records, const function<WalRecord()>& counter = nullptr) {
+    STAT_TIMER(timer, "wal write");
+    if (records.empty() && !counter) return;
+
+    // One write per operation, however many records it produced, framed as
+    // a unit when there is more than one
+    string buffer;
+    size_t unitSize = records.size() + (counter ? 1 : 0);
+    if (unitSize > 1) buffer += encodeWalRecord({'B', "", to_string(unitSize)});
+    for (const auto& r : records) buffer += encodeWalRecord(r);
+
+    StoreFileLock storeFiles;
+    bool due;
+    {
+        lock_guard<mutex> lock(walMutex);
+        WalRecord counted;
+        if (counter) {
+            counted = counter();
+            buffer += encodeWalRecord(counted);
+        }
+        ofstream wal(WAL_FILE, ios::app | ios::binary);
+        wal << buffer;
+        wal.close();
+        timer.wrote(buffer.size());
+        if (counter) applyVenueWalRecord(counted);
+
+        // Counter records are tiny and replay in place, so only line records
+        // count towards the checkpoint threshold
+        bool deadRatioReached = false;
+        for (const auto& r : records) {
+            if (r.op == 'V') walPendingVenueRecords++;
+            else if (noteLineRecord(r)) deadRatioReached = true;
+        }
+        if (counter) walPendingVenueRecords++;
+        walPendingRecords += records.size() + (counter ? 1 : 0);
+        for (const auto& r : records) noteFileWrite(r.file);
+        if (counter) noteFileWrite(counted.file);
+        walRecordsWritten(records.size() + (counter ? 1 : 0));
+        due = deadRatioReached || walPendingRecords - walPendingVenueRecords >= WAL_CHECKPOINT_RECORDS;
+    }
+    if (due) {
+        if (deferCheckpoints) {
+            lock_guard<mutex> lock(compactorMutex);
+            checkpointDue = true;
+            compactionWanted.notify_one();
+        } else {
+            checkpointStores();
         }
     }
+    if (commitMode == COMMIT_EACH_WRITE) commitWal();
+}
 
-    return foundAttendee;
+void walAppend(const string& filename, const string& line) {
+    walWrite({{'A', filename, line}});
 }
 
-Exhibitor findExhibitor(string email) {
-    Exhibitor foundExhibitor;
+void walRemove(const string& filename, const string& line) {
+    walWrite({{'D', filename, line}});
+}
 
-    ifstream inFile("exhibitors.txt");
+void walReplace(const string& filename, const string& oldLine, const string& newLine) {
+    walWrite({{'R', filename, oldLine + WAL_FIELD_SEP + newLine}});
+}
 
-    string line;
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        Exhibitor e;
-        getline(ss, e.id, ',');
-        getline(ss, e.companyName, ',');
-        getline(ss, e.email, ',');
-        getline(ss, e.password, ',');
+string_view firstField(string_view line) {
+    return line.substr(0, line.find(','));
+}
+
+// Applies a file's log records to its rows. A delete or replace acts on the
+// first live row that renders as its line, found through an index of just
+// the lines the records name, and a delete only marks the row dead; one
+// sweep at the end drops the dead rows. A row whose line does not parse is
+// dropped, as the loaders drop it. Returns the number of tombstones applied.
+// lead gives the value a row's line starts with, so only rows whose first
+// field some record names are rendered.
+template <typename Row, typename Parse, typename Render, typename Lead>
+size_t replayLogRecords(vector<Row>& rows, const vector<WalRecord>& records, const string& filename,
+                        Parse parse, Render render, Lead lead) {
+    // Live rows by named line, last in file order first, so the first is at the back
+    unordered_map<string, vector<size_t>> positions;
+    size_t appends = 0;
+    for (const auto& r : records) {
+        if (r.file != filename) continue;
+        if (r.op == 'A') appends++;
+        if (r.op != 'D' && r.op != 'R') continue;
+        positions[r.op == 'R' ? r.payload.substr(0, r.payload.find(WAL_FIELD_SEP)) : r.payload];
+    }
+    auto named = [&](const string& line) -> vector<size_t>* {
+        auto found = positions.find(line);
+        return found == positions.end() ? nullptr : &found->second;
+    };
+    if (!positions.empty()) {
+        unordered_set<string_view> leads;
+        for (const auto& entry : positions) leads.insert(firstField(entry.first));
+        for (size_t i = rows.size(); i-- > 0;) {
+            if (!leads.count(firstField(lead(rows[i])))) continue;
+            if (auto* same = named(render(rows[i]))) same->push_back(i);
+        }
+    }
+    rows.reserve(rows.size() + appends);
+    vector<bool> dead(rows.size(), false);
+
+    size_t tombstones = 0;
+    for (const auto& r : records) {
+        if (r.file != filename || r.op == 'V') continue;
+        if (r.op == 'A') {
+            Row row;
+            dead.push_back(!parse(r.payload, row));
+            if (auto* same = named(r.payload)) same->insert(same->begin(), rows.size());
+            rows.push_back(move(row));
+            continue;
+        }
 
-        if(e.email == email) {
-            foundExhibitor = e;
+        tombstones++;
+        size_t sep = r.payload.find(WAL_FIELD_SEP);
+        vector<size_t>* same = named(r.op == 'R' ? r.payload.substr(0, sep) : r.payload);
+        if (same->empty()) continue;
+        size_t pos = same->back();
+        same->pop_back();
+        if (r.op == 'D') {
+            dead[pos] = true;
+        } else {
+            string replacement = (sep == string::npos) ? "" : r.payload.substr(sep + 1);
+            Row row;
+            dead[pos] = !parse(replacement, row);
+            rows[pos] = move(row);
+            if (auto* moved = named(replacement)) {
+                moved->insert(lower_bound(moved->begin(), moved->end(), pos, greater<size_t>()), pos);
+            }
         }
     }
 
-    return foundExhibitor;
+    size_t kept = 0;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        if (dead[i]) continue;
+        if (kept != i) rows[kept] = move(rows[i]);
+        kept++;
+    }
+    rows.resize(kept);
+    return tombstones;
 }
 
-Admin findAdmin(string email) {
-    Admin foundAdmin;
-
-    ifstream inFile("admins.txt");
+size_t replayWalRecords(vector<string>& lines, const vector<WalRecord>& records, const string& filename) {
+    return replayLogRecords(lines, records, filename,
+                            [](const string& line, string& row) { row = line; return true; },
+                            [](const string& row) -> const string& { return row; },
+                            [](const string& row) -> const string& { return row; });
+}
 
+vector<string> readBaseLines(const string& filename) {
+    STAT_TIMER(timer, "file read");
+    vector<string> lines;
+    ifstream file(filename);
     string line;
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        Admin ad;
-        getline(ss, ad.email, ',');
-        getline(ss, ad.password, ',');
-
-        if(ad.email == email) {
-            foundAdmin = ad;
-        }
+    while (getline(file, line)) {
+        timer.read(line.size() + 1);
+        lines.push_back(line);
     }
+    return lines;
+}
 
-    return foundAdmin;
+// Current contents of a data file: the base file plus its pending log records
+vector<string> readStoreLines(const string& filename) {
+    vector<string> lines = readBaseLines(filename);
+    size_t tombstones = replayWalRecords(lines, *loggedRecords(), filename);
+    noteStoreLoaded(filename, lines.size(), tombstones);
+    return lines;
 }
 
-void loadAnnouncements(vector<Announcement>& announcements) {
-    announcements.clear();
-    ifstream inFile("announcements.txt");
-    if (!inFile.is_open()) {
-        return;
+// Logs only the lines that differ between the current contents and newLines
+void saveStoreLines(const string& filename, const vector<string>& newLines) {
+    STAT_TIMER(timer, "saveStoreLines");
+    StoreFileLock storeFiles;
+    vector<string> oldLines = readStoreLines(filename);
+
+    size_t prefix = 0;
+    while (prefix < oldLines.size() && prefix < newLines.size() && oldLines[prefix] == newLines[prefix]) {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < oldLines.size() - prefix && suffix < newLines.size() - prefix &&
+           oldLines[oldLines.size() - 1 - suffix] == newLines[newLines.size() - 1 - suffix]) {
+        suffix++;
     }
 
-    string line;
-    while (getline(inFile, line)) {
-        size_t pos1 = line.find(',');
-        size_t pos2 = line.find(',', pos1 + 1);
-        size_t pos3 = line.find(',', pos2 + 1);
-        if (pos1 != string::npos && pos2 != string::npos && pos3 != string::npos) {
-            Announcement ann;
-            ann.index = stoi(line.substr(0, pos1));
-            ann.userType = line.substr(pos1 + 1, pos2 - pos1 - 1);
-            ann.title = line.substr(pos2 + 1, pos3 - pos2 - 1);
-            ann.content = line.substr(pos3 + 1);
-            announcements.push_back(ann);
+    size_t oldCount = oldLines.size() - prefix - suffix;
+    size_t newCount = newLines.size() - prefix - suffix;
+
+    vector<WalRecord> records;
+    if (oldCount == newCount) {
+        for (size_t i = 0; i < oldCount; ++i) {
+            records.push_back({'R', filename, oldLines[prefix + i] + WAL_FIELD_SEP + newLines[prefix + i]});
+        }
+    } else {
+        for (size_t i = 0; i < oldCount; ++i) {
+            records.push_back({'D', filename, oldLines[prefix + i]});
+        }
+        for (size_t i = 0; i < newCount; ++i) {
+            records.push_back({'A', filename, newLines[prefix + i]});
         }
     }
-    inFile.close();
+    walWrite(records);
 }
 
-void saveAnnouncements(const vector<Announcement>& announcements) {
-    ofstream outFile("announcements.txt");
-    for (const auto& a : announcements) {
-        outFile << a.index << "," << a.userType << "," << a.title << "," << a.content << "\n";
-    }
-    outFile.close();
+bool fileExists(const string& filename) {
+    ifstream file(filename);
+    return file.good();
 }
 
-void saveFeedback(Feedback feedback) {
-    ofstream file("feedback.txt", ios::app);
-    if (file.is_open()) {
-        file << feedback.email << ",";
-        file << feedback.eventName << ",";
-        file << feedback.rating << ",";
-        file << feedback.comment << "\n";
-        file.close();
-        cout << "Feedback saved successfully." << endl;
-    } else {
-        cout << "Unable to open file for writing." << endl;
+// A durable replace syncs the new contents before the rename and the
+// directory after it, so a crash leaves either the old file or the new one
+void replaceFile(const string& source, const string& target, bool durable) {
+    if (durable) syncPath(source);
+#ifdef _WIN32
+    remove(target.c_str()); // rename does not overwrite on Windows
+#endif
+    rename(source.c_str(), target.c_str());
+    if (durable) syncDirectory();
+}
+
+// Second half of a checkpoint. Safe to run again if a crash interrupted it.
+void finishCheckpoint() {
+    ifstream manifest(CHECKPOINT_MANIFEST);
+    if (!manifest.is_open()) return;
+
+    // The staged files were synced before the manifest was written
+    string filename;
+    while (getline(manifest, filename)) {
+        if (fileExists(filename + ".tmp")) {
+            replaceFile(filename + ".tmp", filename, false);
+        }
+    }
+    manifest.close();
+    syncDirectory();
+
+    // Each step must be on disk before the next: a manifest that came back
+    // after a crash would truncate records logged after this checkpoint
+    ofstream wal(WAL_FILE, ios::trunc);
+    wal.close();
+    syncPath(WAL_FILE);
+    cacheLoggedRecords({});
+    remove(CHECKPOINT_MANIFEST.c_str());
+    syncDirectory();
+    walCheckpointed();
+    walPendingRecords = 0;
+    walPendingVenueRecords = 0;
+    {
+        lock_guard<mutex> lock(walMutex);
+        for (auto& entry : storeLiveness) entry.second.dead = 0;
     }
+    clearDirtyCollections();
 }
 
-vector<Feedback> loadFeedbacks() {
-    vector<Feedback> feedbacks;
-    ifstream file("feedback.txt");
-    string line;
+void syncLoadedCollections();
+void syncVenueFile();
+void writeSnapshots();
 
-    while (getline(file, line)) {
-        stringstream ss(line);
-        Feedback fb;
-        string ratingStr;
+// Counter records are absolute values written in place, so only the last
+// one per counter is applied and redoing it after a crash is harmless
+void redoCounterRecords(const vector<WalRecord>& records) {
+    map<string, const WalRecord*> lastCounters;
+    for (const auto& r : records) {
+        if (r.op == 'V') lastCounters[r.payload.substr(0, r.payload.find(WAL_FIELD_SEP))] = &r;
+    }
+    for (const auto& entry : lastCounters) applyVenueWalRecord(*entry.second);
+    if (!lastCounters.empty()) syncVenueFile();
+}
 
-        getline(ss, fb.email, ',');
-        getline(ss, fb.eventName, ',');
-        getline(ss, ratingStr, ',');
-        getline(ss, fb.comment);
+void checkpointStores() {
+    STAT_TIMER(timer, "checkpoint");
+    // Files are rendered from memory, so every resident copy must first
+    // catch up with what other copies of the program logged
+    StoreFileLock storeFiles;
+    syncLoadedCollections();
+    shared_ptr<const vector<WalRecord>> logged = loggedRecords();
+    const vector<WalRecord>& records = *logged;
 
-        try {
-            fb.rating = stoi(ratingStr);
-        } catch (...) {
-            fb.rating = 0;
+    set<string> files;
+    for (const auto& r : records) {
+        if (r.op != 'V') files.insert(r.file);
+    }
+    redoCounterRecords(records);
+
+    // Stage the new version of every touched file, then commit via the manifest
+    ofstream manifest(CHECKPOINT_MANIFEST + ".tmp");
+    for (const auto& filename : files) {
+        vector<string> lines;
+        if (!renderResidentStore(filename, lines)) {
+            lines = readBaseLines(filename);
+            replayWalRecords(lines, records, filename);
         }
 
-        if (!fb.email.empty()) {
-            feedbacks.push_back(fb);
+        ofstream out(filename + ".tmp", ios::trunc);
+        for (const auto& line : lines) {
+            out << line << "\n";
+            timer.wrote(line.size() + 1);
         }
+        out.close();
+        syncPath(filename + ".tmp");
+
+        manifest << filename << "\n";
     }
-    return feedbacks;
+    manifest.close();
+
+    replaceFile(CHECKPOINT_MANIFEST + ".tmp", CHECKPOINT_MANIFEST);
+    finishCheckpoint();
+    writeSnapshots();
 }
 
-void saveVenues(const vector<Venue>& venues) {
-    ofstream file("venue.txt");
-    for (const auto& v : venues) {
-        file << v.venueID << "," 
-             << v.eventName << "," 
-             << v.rows << "," 
-             << v.columns << "," 
-             << v.ticketType.size() << "," 
-             << v.boothType.size() << "," 
-             << (v.isAvailable ? "1" : "0");
-
-        // Save each ticket type on the same line
-        for (const auto& t : v.ticketType) {
-            file << "," << t.type 
-                 << "," << t.price 
-                 << "," << t.capacity 
-                 << "," << t.sold;
-        }
-        for (const auto& b : v.boothType) {
-            file << "," << b.boothID 
-                 << "," << b.price 
-                 << "," << (b.isRented ? "1" : "0");
-        }
-        file << "\n";
-    }
-    file.close();
+// Run once at startup: finish an interrupted checkpoint and redo the
+// counter records. The line records stay in the log: each collection
+// replays them as it loads, on top of its snapshot when it has a current
+// one, and the next checkpoint folds them into the files.
+// Set when recovery cut a unit short. Counters are applied to venues.dat in
+// place as they are logged, so the file may hold counts from the lost unit
+// and its totals are recounted when it loads.
+bool venueTotalsSuspect = false;
+
+void recoverStores() {
+    StoreFileLock storeFiles;
+    finishCheckpoint();
+    uint64_t validBytes = 0;
+    vector<WalRecord> records = readWal(&validBytes);
+    // Cut a torn tail off, or records appended after it would never be read
+    error_code error;
+    if (fileExists(WAL_FILE) && filesystem::file_size(WAL_FILE, error) > validBytes && !error) {
+        filesystem::resize_file(WAL_FILE, validBytes);
+        syncPath(WAL_FILE);
+        venueTotalsSuspect = true;
+    }
+    redoCounterRecords(records);
+    walPendingRecords = records.size();
+    walPendingVenueRecords = count_if(records.begin(), records.end(), [](const WalRecord& r) { return r.op == 'V'; });
+    // The loads that follow replay these instead of reading the log again
+    cacheLoggedRecords(move(records));
 }
 
-void loadVenues(vector<Venue>& venues) {
+// ==========================
+// ID ALLOCATOR
+// ==========================
+// Numbers for T (ticket), S (session), A (attendee) and E (exhibitor) IDs
+// come from counters in expo.ids. The file records a lease: every number
+// below it may already have been handed out, so it is raised in blocks
+// before use and numbers lost to a crash are skipped, never reused. Other
+// copies of the program lease from the same file, so a new block starts
+// at the newest lease on disk, read under the store file lock.
+const string ID_COUNTER_FILE = "expo.ids";
+const int ID_LEASE_BLOCK = 64;
+
+struct IdCounter {
+    int next = 1;     // next number to hand out
+    int leased = 1;   // first number not covered by the persisted lease
+};
+
+map<char, IdCounter> idCounters;
+
+// Highest number used by IDs with this prefix in one comma-separated field
+int highestIdInFile(const string& filename, size_t field, char prefix) {
+    int maxNum = 0;
+    for (const auto& line : readStoreLines(filename)) {
+        stringstream ss(line);
+        string id;
+        for (size_t i = 0; i <= field; ++i) getline(ss, id, ',');
+
+        if (id.size() > 1 && id[0] == prefix) {
+            try {
+                int num = stoi(id.substr(1));
+                if (num > maxNum) maxNum = num;
+            } catch (...) {
+                // ignore malformed IDs
+            }
+        }
+    }
+    return maxNum;
+}
+
+map<char, int> readIdLeases() {
+    map<char, int> leases;
+    ifstream file(ID_COUNTER_FILE);
+    char prefix;
+    int leased;
+    while (file >> prefix >> leased) leases[prefix] = leased;
+    return leases;
+}
+
+void saveIdLeases(const map<char, int>& leases) {
+    STAT_TIMER(timer, "saveIdCounters");
+    ofstream out(ID_COUNTER_FILE + ".tmp", ios::trunc);
+    for (const auto& entry : leases) {
+        out << entry.first << " " << entry.second << "\n";
+    }
+    out.close();
+    replaceFile(ID_COUNTER_FILE + ".tmp", ID_COUNTER_FILE);
+}
+
+// Writes this copy's leases, keeping any higher lease another copy took
+void saveIdCounters() {
+    StoreFileLock storeFiles;
+    map<char, int> leases = readIdLeases();
+    for (const auto& entry : idCounters) {
+        leases[entry.first] = max(leases[entry.first], entry.second.leased);
+    }
+    saveIdLeases(leases);
+}
+
+// Run once at startup, after recoverStores. Counters missing from the file
+// (first run, or the file was deleted) are seeded from the data files.
+void recoverIdCounters() {
+    StoreFileLock storeFiles;
+    idCounters.clear();
+
+    for (const auto& entry : readIdLeases()) {
+        idCounters[entry.first].next = entry.second;
+        idCounters[entry.first].leased = entry.second;
+    }
+
+    bool seeded = false;
+    auto seed = [&](char p, int highest) {
+        if (idCounters.count(p)) return;
+        idCounters[p].next = highest + 1;
+        idCounters[p].leased = highest + 1;
+        seeded = true;
+    };
+    if (!idCounters.count('T')) {
+        // Refunded tickets keep their IDs in the refund log
+        seed('T', max(highestIdInFile("ticket.txt", 1, 'T'), highestIdInFile("Ticketrefunds.txt", 1, 'T')));
+    }
+    if (!idCounters.count('S')) seed('S', highestIdInFile("sessions.txt", 0, 'S'));
+    if (!idCounters.count('A')) seed('A', highestIdInFile("attendees.txt", 0, 'A'));
+    if (!idCounters.count('E')) seed('E', highestIdInFile("exhibitors.txt", 0, 'E'));
+
+    if (seeded) saveIdCounters();
+}
+
+mutex idMutex;
+
+// Hands out count consecutive numbers and returns the first one
+int allocateIds(char prefix, int count) {
+    lock_guard<mutex> lock(idMutex);
+    IdCounter& c = idCounters[prefix];
+    if (c.next + count > c.leased) {
+        StoreFileLock storeFiles;
+        map<char, int> leases = readIdLeases();
+        c.next = max(c.next, leases[prefix]);
+        c.leased = c.next + count + ID_LEASE_BLOCK;
+        leases[prefix] = c.leased;
+        saveIdLeases(leases);
+    }
+    int first = c.next;
+    c.next += count;
+    return first;
+}
+
+// On a clean exit the unused part of each lease is given back, unless
+// another copy has leased past it since
+void releaseIdLeases() {
+    StoreFileLock storeFiles;
+    map<char, int> leases = readIdLeases();
+    for (auto& entry : idCounters) {
+        if (leases[entry.first] <= entry.second.leased) leases[entry.first] = entry.second.next;
+        entry.second.leased = entry.second.next;
+    }
+    saveIdLeases(leases);
+}
+
+string formatId(char prefix, int num) {
+    // User IDs keep their zero-padded form, e.g. A001
+    if (prefix == 'A' || prefix == 'E') {
+        stringstream ss;
+        ss << prefix << setw(3) << setfill('0') << num;
+        return ss.str();
+    }
+    return string(1, prefix) + to_string(num);
+}
+
+string allocateId(char prefix) {
+    return formatId(prefix, allocateIds(prefix, 1));
+}
+
+// ==========================
+// HELPER FUNCTIONS
+// ==========================
+void clearInputBuffer() {
+    cin.clear();
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+}
+
+// Validators below are hand-written so they allocate nothing; each matches
+// the regex it replaced, kept in the BENCHMARKS section for comparison
+bool isAsciiAlpha(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+bool isAsciiDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Same language as ^[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Za-z]{2,}$
+bool isValidEmail(string_view email) {
+    size_t at = email.find('@');
+    if (at == string_view::npos || at == 0) return false;
+    for (size_t i = 0; i < at; ++i) {
+        char c = email[i];
+        if (!isAsciiAlpha(c) && !isAsciiDigit(c) && string_view("._%+-").find(c) == string_view::npos) return false;
+    }
+
+    string_view domain = email.substr(at + 1);
+    for (char c : domain) {
+        if (!isAsciiAlpha(c) && !isAsciiDigit(c) && c != '.' && c != '-') return false;
+    }
+    // The top-level part after the last dot is letters only, so it is the
+    // only dot that can end the name
+    size_t dot = domain.rfind('.');
+    if (dot == string_view::npos || dot == 0 || domain.size() - dot - 1 < 2) return false;
+    for (size_t i = dot + 1; i < domain.size(); ++i) {
+        if (!isAsciiAlpha(domain[i])) return false;
+    }
+    return true;
+}
+
+int getValidatedChoice(int min, int max, string prompt) {
+    int choice;
+    while (true) {
+        cout << prompt;
+        if (!(cin >> choice)) {
+            // Input is not an integer
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            cout << "Invalid input. Please enter a number between " << min << " and " << max << ".\n\n";
+            continue;
+        }
+
+        if (choice < min || choice > max) {
+            cout << "Invalid choice. Please enter a number between " << min << " and " << max << ".\n\n";
+            continue;
+        }
+
+        cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Clear leftover newline
+        return choice;
+    }
+}
+
+bool isDigits(const string &s) {
+    return !s.empty() && all_of(s.begin(), s.end(), ::isdigit);
+}
+
+// Splits a booth ID like "C2" (column letter, any case, then row digits)
+// into its 1-based column and row
+bool parseBoothID(string_view boothID, int& col, int& row) {
+    if (boothID.size() < 2 || !isAsciiAlpha(boothID[0])) return false;
+    col = toupper(boothID[0]) - 'A' + 1;
+    row = 0;
+    for (size_t i = 1; i < boothID.size(); ++i) {
+        if (!isAsciiDigit(boothID[i])) return false;
+        int digit = boothID[i] - '0';
+        if (row > (numeric_limits<int>::max() - digit) / 10) return false; // out of int range, as stoi rejects it
+        row = row * 10 + digit;
+    }
+    return true;
+}
+
+bool isValidBoothID(const Venue& venue, string_view boothID) {
+    int col, row;
+    if (!parseBoothID(boothID, col, row)) return false;
+    return col <= venue.columns && row >= 1 && row <= venue.rows;
+}
+
+// Converts "HH:MM-HH:MM" into minutes since midnight; checks the shape only
+bool parseTimeSlot(string_view slot, int& start, int& end) {
+    if (slot.size() != 11 || slot[2] != ':' || slot[5] != '-' || slot[8] != ':') return false;
+    for (size_t i : {0, 1, 3, 4, 6, 7, 9, 10}) {
+        if (!isAsciiDigit(slot[i])) return false;
+    }
+    auto number = [&](size_t i) { return (slot[i] - '0') * 10 + (slot[i + 1] - '0'); };
+    int sh = number(0), sm = number(3), eh = number(6), em = number(9);
+
+    // Hours/minutes range check
+    if (sh > 23 || eh > 23 || sm > 59 || em > 59) return false;
+    start = sh * 60 + sm;
+    end = eh * 60 + em;
+    return true;
+}
+
+bool isValidTimeSlot(string_view slot) {
+    int start, end;
+    // Start must be before end
+    return parseTimeSlot(slot, start, end) && start < end;
+}
+
+string minutesToTime(int minutes) {
+    stringstream ss;
+    ss << setw(2) << setfill('0') << minutes / 60 << ":" << setw(2) << setfill('0') << minutes % 60;
+    return ss.str();
+}
+
+// Swallows output; used to keep the menus' messages out of timed runs and
+// machine-readable output
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override {
+        setp(buffer, buffer + sizeof(buffer));
+        return c;
+    }
+private:
+    char buffer[256];
+};
+
+// ==========================
+// FILE HANDLING
+// ==========================
+void loadCredentials(vector<UserCredential> &credentials) {
+    STAT_TIMER(timer, "loadCredentials");
+    credentials.clear();
+
+    // ===== Load Attendees =====
+    if (!fileExists("attendees.txt")) {
+        cout << "Could not open attendees.txt" << endl;
+    } else {
+        for (const auto& line : readStoreLines("attendees.txt")) {
+            stringstream ss(line);
+            string id, name, email, password;
+
+            if (getline(ss, id, ',') &&
+                getline(ss, name, ',') &&
+                getline(ss, email, ',') &&
+                getline(ss, password)) 
+            {
+                credentials.push_back({email, password, "Attendee"});
+            }
+        }
+    }
+
+    // ===== Load Exhibitors =====
+    if (!fileExists("exhibitors.txt")) {
+        cout << "Could not open exhibitors.txt" << endl;
+    } else {
+        for (const auto& line : readStoreLines("exhibitors.txt")) {
+            stringstream ss(line);
+            string id, companyName, email, password;
+
+            if (getline(ss, id, ',') &&
+                getline(ss, companyName, ',') &&
+                getline(ss, email, ',') &&
+                getline(ss, password)) 
+            {
+                credentials.push_back({email, password, "Exhibitor"});
+            }
+        }
+    }
+
+    // ===== Load Admins =====
+    if (!fileExists("admins.txt")) {
+        cout << "Could not open admins.txt" << endl;
+    } else {
+        for (const auto& line : readStoreLines("admins.txt")) {
+            stringstream ss(line);
+            string email, password;
+
+            if (getline(ss, email, ',') &&
+                getline(ss, password)) 
+            {
+                credentials.push_back({email, password, "Admin"});
+            }
+        }
+    }
+}
+
+bool parseAnnouncementLine(const string& line, Announcement& ann) {
+    size_t pos1 = line.find(',');
+    size_t pos2 = line.find(',', pos1 + 1);
+    size_t pos3 = line.find(',', pos2 + 1);
+    if (pos1 == string::npos || pos2 == string::npos || pos3 == string::npos) return false;
+    ann.index = stoi(line.substr(0, pos1));
+    ann.userType = line.substr(pos1 + 1, pos2 - pos1 - 1);
+    ann.title = line.substr(pos2 + 1, pos3 - pos2 - 1);
+    ann.content = line.substr(pos3 + 1);
+    return true;
+}
+
+void loadAnnouncements(vector<Announcement>& announcements) {
+    STAT_TIMER(timer, "loadAnnouncements");
+    announcements.clear();
+
+    for (const auto& line : readStoreLines("announcements.txt")) {
+        Announcement ann;
+        if (parseAnnouncementLine(line, ann)) announcements.push_back(ann);
+    }
+}
+
+string announcementLine(const Announcement& a) {
+    return to_string(a.index) + "," + a.userType + "," + a.title + "," + a.content;
+}
+
+string feedbackLine(const Feedback& fb) {
+    return fb.email + "," + fb.eventName + "," + to_string(fb.rating) + "," + fb.comment;
+}
+
+void saveFeedback(Feedback feedback) {
+    STAT_TIMER(timer, "saveFeedback");
+    walAppend("feedback.txt", feedbackLine(feedback));
+    cout << "Feedback saved successfully." << endl;
+}
+
+bool parseFeedbackLine(const string& line, Feedback& fb) {
+    stringstream ss(line);
+    string ratingStr;
+
+    getline(ss, fb.email, ',');
+    getline(ss, fb.eventName, ',');
+    getline(ss, ratingStr, ',');
+    getline(ss, fb.comment);
+
+    try {
+        fb.rating = stoi(ratingStr);
+    } catch (...) {
+        fb.rating = 0;
+    }
+    return !fb.email.empty();
+}
+
+vector<Feedback> loadFeedbacks() {
+    STAT_TIMER(timer, "loadFeedbacks");
+    vector<Feedback> feedbacks;
+
+    for (const auto& line : readStoreLines("feedback.txt")) {
+        Feedback fb;
+        if (parseFeedbackLine(line, fb)) {
+            feedbacks.push_back(fb);
+        }
+    }
+    return feedbacks;
+}
+
+string venueLine(const Venue& v) {
+    stringstream line;
+    line << v.venueID << "," 
+         << v.eventName << "," 
+         << v.rows << "," 
+         << v.columns << "," 
+         << v.ticketType.size() << "," 
+         << v.boothType.size() << "," 
+         << (v.isAvailable ? "1" : "0");
+
+    // Save each ticket type on the same line
+    for (const auto& t : v.ticketType) {
+        line << "," << t.type 
+             << "," << t.price 
+             << "," << t.capacity 
+             << "," << t.sold;
+    }
+    for (const auto& b : v.boothType) {
+        line << "," << b.boothID 
+             << "," << b.price 
+             << "," << (b.isRented ? "1" : "0");
+    }
+    return line.str();
+}
+
+void exportVenuesCSV(const vector<Venue>& venues) {
+    STAT_TIMER(timer, "exportVenuesCSV");
+    vector<string> lines;
+    for (const auto& v : venues) {
+        lines.push_back(venueLine(v));
+    }
+    saveStoreLines("venue.txt", lines);
+}
+
+void importVenuesCSV(vector<Venue>& venues) {
+    STAT_TIMER(timer, "importVenuesCSV");
     venues.clear();
-    ifstream file("venue.txt");
-    string line;
 
-    while (getline(file, line)) {
+    for (const auto& line : readStoreLines("venue.txt")) {
         stringstream ss(line);
         Venue v;
         string rows, cols, avail, ticketCountStr, boothCountStr;
@@ -551,2865 +1703,6719 @@ void loadVenues(vector<Venue>& venues) {
         }
         venues.push_back(v);
     }
-    file.close();
 }
 
-void saveTicket(const Ticket& ticket) {
-    ofstream file("ticket.txt", ios::app);
-    file << ticket.userEmail << ","
-         << ticket.ticketID << ","
-         << ticket.eventName << ","
-         << ticket.ticketType << ","
-         << ticket.amount << endl;
-    file.close();
+// ==========================
+// VENUE BINARY FORMAT
+// ==========================
+// venues.dat holds one fixed-size slot per venue so a sold count or a booth
+// flag can be updated with a single write at a known offset. Layout (native
+// byte order):
+//   header : magic "EXPV", version, venue count, slot size (4 bytes each)
+//   slot   : venue ID, event name, rows, columns, ticket type count,
+//            available flag, ticket type table, booth price grid,
+//            booth occupancy bitset, then (version 2) ticket revenue per
+//            type, booths rented and booth revenue
+// A version 1 slot is a prefix of a version 2 slot; the sales totals it
+// lacks are rebuilt from the ticket and booth records on first load.
+const string VENUE_DATA_FILE = "venues.dat";
+const uint32_t VENUE_FILE_VERSION = 2;
+
+const int MAX_TICKET_TYPES = 16;
+const int MAX_BOOTH_ROWS = 10;
+const int MAX_BOOTH_COLS = 10;
+const size_t VENUE_ID_LEN = 8;
+const size_t EVENT_NAME_LEN = 64;
+const size_t TICKET_TYPE_NAME_LEN = 32;
+
+const size_t VENUE_HEADER_SIZE = 16;
+const size_t TICKET_TYPE_RECORD_SIZE = TICKET_TYPE_NAME_LEN + 8 + 4 + 4;
+const size_t OCCUPANCY_WORDS = (MAX_BOOTH_ROWS * MAX_BOOTH_COLS + 63) / 64;
+
+const size_t VENUE_OFF_ID = 0;
+const size_t VENUE_OFF_EVENT = VENUE_OFF_ID + VENUE_ID_LEN;
+const size_t VENUE_OFF_ROWS = VENUE_OFF_EVENT + EVENT_NAME_LEN;
+const size_t VENUE_OFF_COLS = VENUE_OFF_ROWS + 4;
+const size_t VENUE_OFF_TICKET_COUNT = VENUE_OFF_COLS + 4;
+const size_t VENUE_OFF_AVAILABLE = VENUE_OFF_TICKET_COUNT + 4;
+const size_t VENUE_OFF_TICKETS = VENUE_OFF_AVAILABLE + 4;
+const size_t VENUE_OFF_BOOTH_PRICES = VENUE_OFF_TICKETS + MAX_TICKET_TYPES * TICKET_TYPE_RECORD_SIZE;
+const size_t VENUE_OFF_OCCUPANCY = VENUE_OFF_BOOTH_PRICES + MAX_BOOTH_ROWS * MAX_BOOTH_COLS * 8;
+const size_t VENUE_RECORD_SIZE_V1 = VENUE_OFF_OCCUPANCY + OCCUPANCY_WORDS * 8;
+const size_t VENUE_OFF_TICKET_REVENUE = VENUE_RECORD_SIZE_V1;
+const size_t VENUE_OFF_BOOTHS_RENTED = VENUE_OFF_TICKET_REVENUE + MAX_TICKET_TYPES * 8;
+const size_t VENUE_OFF_BOOTH_REVENUE = VENUE_OFF_BOOTHS_RENTED + 8; // int32 plus padding
+const size_t VENUE_RECORD_SIZE = VENUE_OFF_BOOTH_REVENUE + 8;
+
+// Offset of a ticket type's sold counter inside a venue slot
+const size_t TICKET_OFF_PRICE = TICKET_TYPE_NAME_LEN;
+const size_t TICKET_OFF_CAPACITY = TICKET_OFF_PRICE + 8;
+const size_t TICKET_OFF_SOLD = TICKET_OFF_CAPACITY + 4;
+
+template <typename T>
+void putValue(string& buffer, size_t offset, T value) {
+    memcpy(&buffer[offset], &value, sizeof(T));
 }
 
-void loadTickets(vector<Ticket>& tickets) {
-    tickets.clear();
-    ifstream file("ticket.txt");
-    string line;
-    while (getline(file, line)) {
-        stringstream ss(line);
-        Ticket t;
-        string amountStr;
+template <typename T>
+T getValue(const string& buffer, size_t offset) {
+    T value;
+    memcpy(&value, &buffer[offset], sizeof(T));
+    return value;
+}
 
-        getline(ss, t.userEmail, ',');
-        getline(ss, t.ticketID, ',');
-        getline(ss, t.eventName, ',');
-        getline(ss, t.ticketType, ',');
-        getline(ss, amountStr);
+void putText(string& buffer, size_t offset, const string& text, size_t width) {
+    size_t len = min(text.size(), width - 1); // always keep a terminating zero
+    memcpy(&buffer[offset], text.data(), len);
+}
 
-        try { 
-            t.amount = stod(amountStr);
-        } catch (...) { 
-            t.amount = 0.0; 
-        }
-        tickets.push_back(t);
-    }
-    file.close();
+string getText(const string& buffer, size_t offset, size_t width) {
+    string text(&buffer[offset], width);
+    return text.substr(0, text.find('\0'));
 }
 
-void saveBooth(const Booth& booth) {
-    ofstream file("booth.txt", ios::app);
-    file << booth.userEmail << "," 
-         << booth.venueID << "," 
-         << booth.boothID << "," 
-         << (booth.isRented ? "1" : "0") << "," 
-         << booth.amount << endl;
-    file.close();
+size_t boothGridIndex(int row, int col) {
+    return row * MAX_BOOTH_COLS + col;
 }
 
-void loadBooths(vector<Booth>& booths) {
-    booths.clear();
-    ifstream file("booth.txt");
-    string line;
-    while (getline(file, line)) {
-        stringstream ss(line);
-        Booth b;
-        string rentedStr, amountStr;
+// Maps a booth ID like "C2" to its 0-based grid position
+bool boothGridPosition(const string& boothID, int& row, int& col) {
+    if (!parseBoothID(boothID, col, row)) return false;
+    row--;
+    col--;
+    return row >= 0 && row < MAX_BOOTH_ROWS && col >= 0 && col < MAX_BOOTH_COLS;
+}
 
-        getline(ss, b.userEmail, ',');
-        getline(ss, b.venueID, ',');
-        getline(ss, b.boothID, ',');
-        getline(ss, rentedStr, ',');
-        getline(ss, amountStr);
+// The stored form of a booth ID: "a04" and "A0004" both name A4. Empty
+// when the ID is not on the grid.
+string canonicalBoothID(const string& boothID) {
+    int row, col;
+    if (!boothGridPosition(boothID, row, col)) return "";
+    return string(1, 'A' + col) + to_string(row + 1);
+}
 
-        try{
-            b.amount = stod(amountStr);
-        }catch(...){
-            b.amount = 0.0;
-        }
+// The rented booths as stored in venues.dat, one bit per grid cell
+void venueOccupancyWords(const Venue& v, uint64_t (&occupancy)[OCCUPANCY_WORDS]) {
+    fill(begin(occupancy), end(occupancy), 0);
+    for (const auto& b : v.boothType) {
+        int row, col;
+        if (!b.isRented || !boothGridPosition(b.boothID, row, col)) continue;
+        size_t index = boothGridIndex(row, col);
+        occupancy[index / 64] |= (uint64_t(1) << (index % 64));
+    }
+}
 
-        b.isRented = (rentedStr == "1");
-        booths.push_back(b);
+string encodeVenueRecord(const Venue& v) {
+    string record(VENUE_RECORD_SIZE, '\0');
+    putText(record, VENUE_OFF_ID, v.venueID, VENUE_ID_LEN);
+    putText(record, VENUE_OFF_EVENT, v.eventName, EVENT_NAME_LEN);
+    putValue<int32_t>(record, VENUE_OFF_ROWS, v.rows);
+    putValue<int32_t>(record, VENUE_OFF_COLS, v.columns);
+    putValue<int32_t>(record, VENUE_OFF_TICKET_COUNT, min((int)v.ticketType.size(), MAX_TICKET_TYPES));
+    putValue<int32_t>(record, VENUE_OFF_AVAILABLE, v.isAvailable ? 1 : 0);
+
+    for (size_t i = 0; i < v.ticketType.size() && i < (size_t)MAX_TICKET_TYPES; ++i) {
+        size_t base = VENUE_OFF_TICKETS + i * TICKET_TYPE_RECORD_SIZE;
+        putText(record, base, v.ticketType[i].type, TICKET_TYPE_NAME_LEN);
+        putValue<double>(record, base + TICKET_OFF_PRICE, v.ticketType[i].price);
+        putValue<int32_t>(record, base + TICKET_OFF_CAPACITY, v.ticketType[i].capacity);
+        putValue<int32_t>(record, base + TICKET_OFF_SOLD, v.ticketType[i].sold);
+        putValue<double>(record, VENUE_OFF_TICKET_REVENUE + i * 8, v.ticketType[i].revenue);
+    }
+    putValue<int32_t>(record, VENUE_OFF_BOOTHS_RENTED, v.boothsRented);
+    putValue<double>(record, VENUE_OFF_BOOTH_REVENUE, v.boothRevenue);
+
+    uint64_t occupancy[OCCUPANCY_WORDS];
+    venueOccupancyWords(v, occupancy);
+    for (const auto& b : v.boothType) {
+        int row, col;
+        if (!boothGridPosition(b.boothID, row, col)) continue;
+        putValue<double>(record, VENUE_OFF_BOOTH_PRICES + boothGridIndex(row, col) * 8, b.price);
     }
-    file.close();
+    for (size_t w = 0; w < OCCUPANCY_WORDS; ++w) {
+        putValue<uint64_t>(record, VENUE_OFF_OCCUPANCY + w * 8, occupancy[w]);
+    }
+    return record;
 }
 
-void saveSessions(const vector<Session>& sessions) {
-    ofstream file("sessions.txt");
-    if (!file.is_open()) {
-        cout << "Error opening sessions.txt for writing.\n";
-        return;
+Venue decodeVenueRecord(const string& record) {
+    Venue v;
+    v.venueID = getText(record, VENUE_OFF_ID, VENUE_ID_LEN);
+    v.eventName = getText(record, VENUE_OFF_EVENT, EVENT_NAME_LEN);
+    v.rows = getValue<int32_t>(record, VENUE_OFF_ROWS);
+    v.columns = getValue<int32_t>(record, VENUE_OFF_COLS);
+    v.isAvailable = getValue<int32_t>(record, VENUE_OFF_AVAILABLE) != 0;
+
+    int ticketCount = min(getValue<int32_t>(record, VENUE_OFF_TICKET_COUNT), MAX_TICKET_TYPES);
+    for (int i = 0; i < ticketCount; ++i) {
+        size_t base = VENUE_OFF_TICKETS + i * TICKET_TYPE_RECORD_SIZE;
+        TicketType t;
+        t.type = getText(record, base, TICKET_TYPE_NAME_LEN);
+        t.price = getValue<double>(record, base + TICKET_OFF_PRICE);
+        t.capacity = getValue<int32_t>(record, base + TICKET_OFF_CAPACITY);
+        t.sold = getValue<int32_t>(record, base + TICKET_OFF_SOLD);
+        t.revenue = getValue<double>(record, VENUE_OFF_TICKET_REVENUE + i * 8);
+        v.ticketType.push_back(t);
+    }
+    v.boothsRented = getValue<int32_t>(record, VENUE_OFF_BOOTHS_RENTED);
+    v.boothRevenue = getValue<double>(record, VENUE_OFF_BOOTH_REVENUE);
+
+    // Booth IDs are regenerated in the same row-major order as makeNewVenueBooking
+    for (int i = 0; i < v.rows && i < MAX_BOOTH_ROWS; i++) {
+        for (int j = 0; j < v.columns && j < MAX_BOOTH_COLS; j++) {
+            size_t index = boothGridIndex(i, j);
+            uint64_t word = getValue<uint64_t>(record, VENUE_OFF_OCCUPANCY + (index / 64) * 8);
+            BoothType bt;
+            bt.boothID = string(1, 'A' + j) + to_string(i + 1);
+            bt.price = getValue<double>(record, VENUE_OFF_BOOTH_PRICES + index * 8);
+            bt.isRented = (word >> (index % 64)) & 1;
+            v.boothType.push_back(bt);
+        }
     }
-    for (const auto& s : sessions) {
-        file << s.sessionID << ","
-             << s.venueID << ","
-             << s.exhibitorEmail << ","
-             << s.topic << ","
-             << s.timeSlot << endl;
+    return v;
+}
+
+void saveVenues(const vector<Venue>& venues) {
+    STAT_TIMER(timer, "saveVenues");
+    StoreFileLock storeFiles;
+    noteFileWrite(VENUE_DATA_FILE);
+    // Logged counter updates must land before the file is replaced, or a
+    // replay after a crash would write them over the new contents
+    if (walPendingVenueRecords > 0) checkpointStores();
+
+    string header(VENUE_HEADER_SIZE, '\0');
+    memcpy(&header[0], "EXPV", 4);
+    putValue<uint32_t>(header, 4, VENUE_FILE_VERSION);
+    putValue<uint32_t>(header, 8, venues.size());
+    putValue<uint32_t>(header, 12, VENUE_RECORD_SIZE);
+
+    ofstream file(VENUE_DATA_FILE + ".tmp", ios::binary | ios::trunc);
+    file.write(header.data(), header.size());
+    for (const auto& v : venues) {
+        string record = encodeVenueRecord(v);
+        file.write(record.data(), record.size());
     }
+    timer.wrote(header.size() + venues.size() * VENUE_RECORD_SIZE);
     file.close();
+    replaceFile(VENUE_DATA_FILE + ".tmp", VENUE_DATA_FILE);
 }
 
-void loadSessions(vector<Session>& sessions) {
-    ifstream file("sessions.txt");
-    string line;
+// Sets needsTotals when the file predates the stored sales totals
+bool loadVenuesBinary(vector<Venue>& venues, bool& needsTotals) {
+    STAT_TIMER(timer, "file read");
+    ifstream file(VENUE_DATA_FILE, ios::binary);
+    if (!file.is_open()) return false;
+
+    string header(VENUE_HEADER_SIZE, '\0');
+    if (!file.read(&header[0], header.size())) return false;
+    uint32_t version = getValue<uint32_t>(header, 4);
+    size_t slotSize = (version == 1) ? VENUE_RECORD_SIZE_V1 : VENUE_RECORD_SIZE;
+    if (header.compare(0, 4, "EXPV") != 0 ||
+        (version != 1 && version != VENUE_FILE_VERSION) ||
+        getValue<uint32_t>(header, 12) != slotSize) {
+        cout << "Unsupported " << VENUE_DATA_FILE << " format.\n";
+        return false;
+    }
+    needsTotals = (version == 1);
 
-    if (!file) {
-        cout << "No sessions found yet.\n";
-        return;
+    uint32_t count = getValue<uint32_t>(header, 8);
+    string record(VENUE_RECORD_SIZE, '\0'); // an older, shorter slot leaves the tail zeroed
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!file.read(&record[0], slotSize)) break;
+        timer.read(slotSize);
+        venues.push_back(decodeVenueRecord(record));
     }
+    return true;
+}
 
-    while (getline(file, line)) {
-        stringstream ss(line);
-        Session s;
-        getline(ss, s.sessionID, ',');
-        getline(ss, s.venueID, ',');
-        getline(ss, s.exhibitorEmail, ',');
-        getline(ss, s.topic, ',');
-        getline(ss, s.timeSlot, ',');
+void rebuildVenueTotals(vector<Venue>& venues);
 
-        if (!s.sessionID.empty()) { // safety check
-            sessions.push_back(s);
-        }
+void loadVenues(vector<Venue>& venues) {
+    STAT_TIMER(timer, "loadVenues");
+    venues.clear();
+    bool needsTotals = false;
+    if (loadVenuesBinary(venues, needsTotals)) {
+        if (!needsTotals && !venueTotalsSuspect) return;
+    } else {
+        // First run (or unreadable binary file): import the CSV and convert it
+        venues.clear();
+        importVenuesCSV(venues);
     }
-    file.close();
+    rebuildVenueTotals(venues);
+    saveVenues(venues);
+    venueTotalsSuspect = false;
 }
 
-// ==========================
-// LOGIN MODULE
-// ==========================
-string login(vector<UserCredential> &credentials, const string &role) {
-    const int maxAttempts = 3;
-    int attempts = 0;
+void writeVenueBytes(size_t offset, const void* data, size_t len) {
+    STAT_TIMER(timer, "venue file write");
+    StoreFileLock storeFiles;
+    noteFileWrite(VENUE_DATA_FILE);
+    fstream file(VENUE_DATA_FILE, ios::in | ios::out | ios::binary);
+    if (!file.is_open()) return;
+    file.seekp(offset);
+    file.write(static_cast<const char*>(data), len);
+    timer.wrote(len);
+}
 
-    while (attempts < maxAttempts) {
-        cout << "============================================\n";
-        cout << "||     " << right << setw(13) << role << " Login Page           ||\n";
-        cout << "============================================\n";
-        LoginDetails user;
-        cout << "Enter email: ";
-        getline(cin, user.email);
-        cout << "Enter password: ";
-        getline(cin, user.password);
+void syncVenueFile() {
+    syncPath(VENUE_DATA_FILE);
+}
 
-        for (auto &cred : credentials) {
-            if (cred.userType == role && cred.email == user.email && cred.password == user.password) {
-                cout << "\n============================================\n";
-                cout << "||  Login successful! Welcome, " << left << setw(10) << role << " ||\n";
-                cout << "============================================\n";
-                return user.email;
-            }
-        }
-        cout << "\nInvalid credentials. Attempts left: " << maxAttempts - attempts - 1 << "\n";
-        attempts++;
-    }
-    cout << "===============================================\n";
-    cout << "||" << right << setw(10) << role << " login failed after 3 attempts   ||\n";
-    cout << "===============================================\n";
-    return "";
+size_t venueSlotOffset(size_t venueIndex) {
+    return VENUE_HEADER_SIZE + venueIndex * VENUE_RECORD_SIZE;
 }
 
-// ==========================
-// SIGN UP MODULE
-// ==========================
-void signUp(vector<UserCredential> &credentials) {
+// Rewrites one venue slot in place (event created or closed)
+void saveVenueRecord(size_t venueIndex, const Venue& v) {
+    STAT_TIMER(timer, "saveVenueRecord");
+    if (walPendingVenueRecords > 0) checkpointStores();
+    string record = encodeVenueRecord(v);
+    writeVenueBytes(venueSlotOffset(venueIndex), record.data(), record.size());
+    syncVenueFile(); // not logged, so this is the commit
+}
 
-    const string adminVerificationPassword = "secureAdmin123";
-    int choice;
+void updateVenueTicketStats(size_t venueIndex, size_t typeIndex, int sold, double revenue) {
+    if (typeIndex >= (size_t)MAX_TICKET_TYPES) return;
+    int32_t value = sold;
+    size_t offset = venueSlotOffset(venueIndex) + VENUE_OFF_TICKETS +
+                    typeIndex * TICKET_TYPE_RECORD_SIZE + TICKET_OFF_SOLD;
+    writeVenueBytes(offset, &value, sizeof(value));
+    writeVenueBytes(venueSlotOffset(venueIndex) + VENUE_OFF_TICKET_REVENUE + typeIndex * 8, &revenue, sizeof(revenue));
+}
 
-    while (true)
-    {
-        cout << "=======================================================\n";
-        cout << "||                    Sign Up Menu                   ||\n";
-        cout << "=======================================================\n";
-        cout << "|| Register as:                                      ||\n";
-        cout << "|| 1. Attendee                                       ||\n";
-        cout << "|| 2. Exhibitor                                      ||\n";
-        cout << "|| 3. Admin                                          ||\n";
-        cout << "|| 0. Return to Main Menu                            ||\n";
-        cout << "=======================================================\n";
-        cout << "Choice: ";
+void updateVenueBoothStats(size_t venueIndex, int rented, double revenue, const uint64_t* occupancy) {
+    int32_t value = rented;
+    writeVenueBytes(venueSlotOffset(venueIndex) + VENUE_OFF_BOOTHS_RENTED, &value, sizeof(value));
+    writeVenueBytes(venueSlotOffset(venueIndex) + VENUE_OFF_BOOTH_REVENUE, &revenue, sizeof(revenue));
+    if (occupancy) {
+        writeVenueBytes(venueSlotOffset(venueIndex) + VENUE_OFF_OCCUPANCY, occupancy, OCCUPANCY_WORDS * 8);
+    }
+}
 
-        cin >> choice;
-        cout << endl;
+// Counter keys: "<venue>,T,<ticket type>" for a ticket type's sold count and
+// revenue, "<venue>,B" for a venue's booth count, revenue and occupancy
+// words. Each record holds whole values, so the last one per key is enough.
+string venueStatsValue(double value) {
+    stringstream ss;
+    ss << setprecision(17) << value;
+    return ss.str();
+}
 
-        if (cin.fail() || choice < 0 || choice > 3) {
-            cin.clear();
-            clearInputBuffer();
-            cout << "=======================================================\n";
-            cout << "||         Invalid Choice, please try again!          ||\n";
-            cout << "=======================================================\n";
-        } else {
-            break;
-        }
-        
-    }
-    clearInputBuffer();
+WalRecord venueTicketStatsRecord(size_t venueIndex, size_t typeIndex, const TicketType& tt) {
+    return {'V', VENUE_DATA_FILE, to_string(venueIndex) + ",T," + to_string(typeIndex) + WAL_FIELD_SEP +
+                                  to_string(tt.sold) + "," + venueStatsValue(tt.revenue)};
+}
 
-    // Verify if user has the permission to create an admin account
-    if(choice == 3) {
-        cout << "Enter admin verification password: ";
-        string verificationPassword;
-        getline(cin, verificationPassword);
-        if (verificationPassword != adminVerificationPassword) {
-            cout << "======================================\n";
-            cout << "|| Incorrect admin password.        ||\n";
-            cout << "|| Admin account creation denied.   ||\n";
-            cout << "======================================\n";
+WalRecord venueBoothStatsRecord(size_t venueIndex, const Venue& v) {
+    uint64_t occupancy[OCCUPANCY_WORDS];
+    venueOccupancyWords(v, occupancy);
+    string payload = to_string(venueIndex) + ",B" + WAL_FIELD_SEP + to_string(v.boothsRented) + "," +
+                     venueStatsValue(v.boothRevenue);
+    for (uint64_t word : occupancy) payload += "," + to_string(word);
+    return {'V', VENUE_DATA_FILE, payload};
+}
 
-            return;
-        }
+void applyVenueWalRecord(const WalRecord& r) {
+    size_t sep = r.payload.find(WAL_FIELD_SEP);
+    if (sep == string::npos) return;
+    stringstream key(r.payload.substr(0, sep));
+    stringstream values(r.payload.substr(sep + 1));
+
+    size_t venueIndex, typeIndex;
+    char comma, kind;
+    int count;
+    double revenue;
+    if (!(key >> venueIndex >> comma >> kind) || !(values >> count >> comma >> revenue)) return;
+    if (kind == 'T' && key >> comma >> typeIndex) {
+        updateVenueTicketStats(venueIndex, typeIndex, count, revenue);
+    } else if (kind == 'B') {
+        // Records from before the occupancy words carry the totals only
+        uint64_t occupancy[OCCUPANCY_WORDS];
+        bool hasOccupancy = true;
+        for (auto& word : occupancy) hasOccupancy = hasOccupancy && values >> comma >> word;
+        updateVenueBoothStats(venueIndex, count, revenue, hasOccupancy ? occupancy : nullptr);
+    }
+}
 
+size_t findVenueIndex(const vector<Venue>& venues, const string& venueID) {
+    for (size_t i = 0; i < venues.size(); ++i) {
+        if (venues[i].venueID == venueID) return i;
     }
+    return venues.size();
+}
 
-    if(choice == 1) {
-        // Attendee signup
-        Attendee a;
+// Booth types are laid out row-major, so the cell's slot is checked first
+BoothType* findBoothType(Venue& v, const string& boothID) {
+    int row, col;
+    if (boothGridPosition(boothID, row, col) && row < v.rows && col < v.columns) {
+        size_t slot = row * v.columns + col;
+        if (slot < v.boothType.size() && v.boothType[slot].boothID == boothID) return &v.boothType[slot];
+    }
+    for (auto& bt : v.boothType) {
+        if (bt.boothID == boothID) return &bt;
+    }
+    return nullptr;
+}
 
-        // id field (auto generated)
-        a.id = generateUserID("attendees.txt", 'A');
-        cout << "Generated Attendee ID: " << a.id << endl;
+// A double as a default-formatted stream writes it ("%g"), without a stream
+string streamDouble(double value) {
+    char text[32];
+    snprintf(text, sizeof(text), "%g", value);
+    return text;
+}
 
-        // name field
-        do {
-            cout << "Enter Name: "; getline(cin, a.name);
+// Built in one allocation: replay renders every row when the log names lines
+string ticketLine(const Ticket& ticket) {
+    string amount = streamDouble(ticket.amount);
+    string line;
+    line.reserve(ticket.userEmail.size() + ticket.ticketID.size() + ticket.eventName.size() +
+                 ticket.ticketType.size() + amount.size() + 4);
+    line += ticket.userEmail; line += ',';
+    line += ticket.ticketID; line += ',';
+    line += ticket.eventName; line += ',';
+    line += ticket.ticketType; line += ',';
+    line += amount;
+    return line;
+}
 
-            if(a.name.empty()) {
-                cout << "\n==================================================\n";
-                cout << "||    Name cannot be empty. Please try again    ||\n";
-                cout << "==================================================\n\n";
-            }
-        } while (a.name.empty());
+void saveTicket(const Ticket& ticket) {
+    STAT_TIMER(timer, "saveTicket");
+    walAppend("ticket.txt", ticketLine(ticket));
+}
 
+// Reference stringstream loader, kept for the loader benchmark
+void loadTicketsStream(vector<Ticket>& tickets, const string& filename) {
+    tickets.clear();
+    ifstream file(filename);
+    string line;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        Ticket t;
+        string userEmail, eventName, ticketType, amountStr;
 
-        // email field
-        while(true) {
-            bool emailExists = false;
-            cout << "Enter Email: "; getline(cin, a.email);
-            if (!isValidEmail(a.email)) {
-                cout << "\n==============================================\n";
-                cout << "||  Invalid email format. Please try again  ||\n";
-                cout << "==============================================\n\n";
+        getline(ss, userEmail, ',');
+        getline(ss, t.ticketID, ',');
+        getline(ss, eventName, ',');
+        getline(ss, ticketType, ',');
+        getline(ss, amountStr);
+        t.userEmail = userEmail;
+        t.eventName = eventName;
+        t.ticketType = ticketType;
 
-            } else {
-                for (const auto& cred : credentials) {
-                    if (cred.email == a.email) {
-                        cout << "\n=======================================================\n";
-                        cout << "|| Email already exists. Please use a different email. ||\n";
-                        cout << "=========================================================\n\n";
-                        emailExists = true;
-                        break;
-                    }
-                }
+        try { 
+            t.amount = stod(amountStr);
+        } catch (...) { 
+            t.amount = 0.0; 
+        }
+        tickets.push_back(t);
+    }
+    file.close();
+}
 
-                if(!emailExists) { break; }
+// ==========================
+// MAPPED TICKET VIEWS
+// ==========================
+// Read-only ticket access straight out of a memory-mapped ticket.txt. The
+// string_view fields point into the mapping (or into pendingLines for rows
+// still in the write-ahead log), so no per-field strings are allocated.
+class MappedFile {
+public:
+    explicit MappedFile(const string& filename) {
+        STAT_TIMER(timer, "file map");
+#ifdef _WIN32
+        ifstream file(filename, ios::binary);
+        buffer.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+        bytes = buffer.data();
+        length = buffer.size();
+        timer.read(length);
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                madvise(mapped, info.st_size, MADV_SEQUENTIAL);
+                bytes = static_cast<const char*>(mapped);
+                length = info.st_size;
+                timer.read(length);
             }
         }
+        close(fd);
+#endif
+    }
 
-        // password field
-        do {
-            cout << "Enter Password: "; getline(cin, a.password);
+    ~MappedFile() {
+#ifndef _WIN32
+        if (bytes) munmap(const_cast<char*>(bytes), length);
+#endif
+    }
 
-            if(a.password.empty()) {
-                cout << "\n==================================================\n";
-                cout << "||  Password cannot be empty. Please try again  ||\n";
-                cout << "==================================================\n\n";
-            }
-        } while (a.password.empty());
-        
-        // save to attendees.txt
-        ofstream outFile("attendees.txt", ios::app);
-        outFile << a.id << "," << a.name << "," << a.email << "," << a.password << "\n";
-        outFile.close();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
 
-        // save to vector
-        credentials.push_back({a.email, a.password, "Attendee"});
-        cout << "\nAttendee account created successfully!\n";
-    
-    } else if(choice == 2) {
-        // Exhibitor signup
-        Exhibitor e;
+    string_view data() const { return string_view(bytes ? bytes : "", length); }
 
-        // id field (auto generated)
-        e.id = generateUserID("exhibitors.txt", 'E');
-        cout << "Generated Exhibitor ID: " << e.id << endl;
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    string buffer;
+#endif
+};
 
-        // company name field
-        do {
-            cout << "Enter Company Name: "; getline(cin, e.companyName);
+struct TicketView {
+    string_view line;
+    string_view userEmail;
+    string_view ticketID;
+    string_view eventName;
+    string_view ticketType;
+    double amount;
+};
 
-            if(e.companyName.empty()) {
-                cout << "\n====================================================\n";
-                cout << "|| Company name cannot be empty. Please try again ||\n";
-                cout << "====================================================\n\n";
-            }
-        } while (e.companyName.empty());
-        
-        // email field
-        while(true) {
-            bool emailExists = false;
-            cout << "Enter Email: "; getline(cin, e.email);
-            if (!isValidEmail(e.email)) {
-                cout << "\n==============================================\n";
-                cout << "||  Invalid email format. Please try again  ||\n";
-                cout << "==============================================\n\n";
+struct TicketViewSet {
+    unique_ptr<MappedFile> file;
+    deque<string> pendingLines; // rows written through the log since the last checkpoint
+    vector<TicketView> tickets;
+};
 
-            } else {
-                for (const auto& cred : credentials) {
-                    if (cred.email == e.email) {
-                        cout << "\n=======================================================\n";
-                        cout << "|| Email already exists. Please use a different email. ||\n";
-                        cout << "=========================================================\n\n";
-                        emailExists = true;
-                        break;
-                    }
-                }
+// Splits one "email,id,event,type,amount" line the same way loadTickets does
+TicketView parseTicketView(string_view line) {
+    TicketView t;
+    t.line = line;
+    string_view* fields[4] = {&t.userEmail, &t.ticketID, &t.eventName, &t.ticketType};
+    string_view rest = line;
+    for (auto* field : fields) {
+        size_t comma = rest.find(',');
+        *field = rest.substr(0, comma);
+        rest = (comma == string_view::npos) ? string_view() : rest.substr(comma + 1);
+    }
 
-                if(!emailExists) { break; }
-            }
+    t.amount = 0.0;
+    if (from_chars(rest.data(), rest.data() + rest.size(), t.amount).ec != errc()) {
+        t.amount = 0.0;
+    }
+    return t;
+}
+
+void loadTicketViews(TicketViewSet& set, const string& filename = "ticket.txt") {
+    STAT_TIMER(timer, "loadTicketViews");
+    set.tickets.clear();
+    set.pendingLines.clear();
+    set.file = make_unique<MappedFile>(filename);
+
+    // Turn this file's log records into deletes and replacements of base rows,
+    // plus the rows appended after the last checkpoint
+    shared_ptr<const vector<WalRecord>> logged = loggedRecords();
+    const vector<WalRecord>& records = *logged;
+    deque<string> appended;
+    unordered_map<string_view, int> removed;
+    unordered_map<string_view, deque<string_view>> replaced;
+    size_t tombstones = 0;
+    for (const auto& r : records) {
+        if (r.file != filename) continue;
+        if (r.op == 'A') {
+            appended.push_back(r.payload);
+            continue;
         }
-            
-        // password field
-        do {
-            cout << "Enter Password: "; getline(cin, e.password);
+        tombstones++;
 
-            if(e.password.empty()) {
-            cout << "\n==================================================\n";
-            cout << "||  Password cannot be empty. Please try again  ||\n";
-            cout << "==================================================\n\n";
-            }
-        } while (e.password.empty());
-        
-        // save to exhibitors.txt
-        ofstream outFile("exhibitors.txt", ios::app);
-        outFile << e.id << "," << e.companyName << "," << e.email << "," << e.password << "\n";
-        outFile.close();
+        string_view target = r.payload;
+        string_view replacement;
+        if (r.op == 'R') {
+            size_t sep = target.find(WAL_FIELD_SEP);
+            replacement = (sep == string_view::npos) ? string_view() : target.substr(sep + 1);
+            target = target.substr(0, sep);
+        }
 
-        // save to vector
-        credentials.push_back({e.email, e.password, "Exhibitor"});
-        cout << "\nExhibitor account created successfully!\n";
+        // A record that touches a row appended earlier in the log applies to it directly
+        auto pending = find(appended.begin(), appended.end(), target);
+        if (pending != appended.end()) {
+            if (r.op == 'D') appended.erase(pending);
+            else *pending = string(replacement);
+        } else if (r.op == 'D') {
+            removed[target]++;
+        } else {
+            replaced[target].push_back(replacement);
+        }
+    }
 
-    } else if(choice == 3) {
-        // Admin signup
-        Admin admin;
+    string_view data = set.file->data();
+    set.tickets.reserve(count(data.begin(), data.end(), '\n') + appended.size() + 1);
 
-        // email field
-        while(true) {
-            bool emailExists = false;
-            cout << "Enter Email: "; getline(cin, admin.email);
-            if (!isValidEmail(admin.email)) {
-                cout << "\n==============================================\n";
-                cout << "||  Invalid email format. Please try again  ||\n";
-                cout << "==============================================\n\n";
+    size_t pos = 0;
+    while (pos < data.size()) {
+        size_t end = data.find('\n', pos);
+        if (end == string_view::npos) end = data.size();
+        string_view line = data.substr(pos, end - pos);
+        pos = end + 1;
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
 
-            } else {
-                for(const auto& cred : credentials) {
-                    if (cred.email == admin.email) {
-                        cout << "\n=======================================================\n";
-                        cout << "|| Email already exists. Please use a different email. ||\n";
-                        cout << "=========================================================\n\n";
-                        emailExists = true;
-                        break;
-                    }
-                }
-                if(!emailExists) { break; }
+        if (!removed.empty()) {
+            auto gone = removed.find(line);
+            if (gone != removed.end()) {
+                if (--gone->second == 0) removed.erase(gone);
+                continue;
             }
         }
-
-        // password field
-        do {
-            cout << "Enter Password: "; getline(cin, admin.password);
-
-            if(admin.password.empty()) {
-            cout << "\n==================================================\n";
-            cout << "||  Password cannot be empty. Please try again  ||\n";
-            cout << "==================================================\n\n";
+        if (!replaced.empty()) {
+            auto swapped = replaced.find(line);
+            if (swapped != replaced.end()) {
+                set.pendingLines.emplace_back(swapped->second.front());
+                swapped->second.pop_front();
+                if (swapped->second.empty()) replaced.erase(swapped);
+                set.tickets.push_back(parseTicketView(set.pendingLines.back()));
+                continue;
             }
-        } while (admin.password.empty());
+        }
+        set.tickets.push_back(parseTicketView(line));
+    }
 
-        // save to admins.txt
-        ofstream outFile("admins.txt", ios::app);
-        outFile << admin.email << "," << admin.password << "\n";
-        outFile.close();
+    // deque keeps earlier strings in place, so the views stay valid
+    for (auto& line : appended) {
+        set.pendingLines.push_back(move(line));
+        set.tickets.push_back(parseTicketView(set.pendingLines.back()));
+    }
+    noteStoreLoaded(filename, set.tickets.size(), tombstones);
+}
 
-        // save to vector
-        credentials.push_back({admin.email, admin.password, "Admin"});
-        cout << "\nAdmin account created successfully!\n";
+void loadTickets(vector<Ticket>& tickets, const string& filename = "ticket.txt") {
+    STAT_TIMER(timer, "loadTickets");
+    TicketViewSet views;
+    loadTicketViews(views, filename);
 
+    tickets.clear();
+    tickets.reserve(views.tickets.size());
+    for (const auto& v : views.tickets) {
+        tickets.push_back({Symbol(v.userEmail), string(v.ticketID), Symbol(v.eventName),
+                           Symbol(v.ticketType), v.amount});
     }
 }
 
-// ==========================
-// USER PROFILES
-// ==========================
-void viewAttendeeProfile(Attendee &a) {
-    cout << "\n============================================================\n";
-    cout << "||                   ATTENDEE PROFILE                     ||\n";
-    cout << "============================================================\n";
-    cout << "|| ID        : " << left << setw(43) << a.id << "||\n";
-    cout << "|| Name      : " << left << setw(43) << a.name << "||\n";
-    cout << "|| Email     : " << left << setw(43) << a.email << "||\n";
-    cout << "|| Password  : " << left << setw(43) << a.password << "||\n";
-    cout << "============================================================\n\n";
+bool parseTicketLine(const string& line, Ticket& t) {
+    TicketView v = parseTicketView(line);
+    t = {Symbol(v.userEmail), string(v.ticketID), Symbol(v.eventName), Symbol(v.ticketType), v.amount};
+    return true;
 }
 
-void updateAttendeeProfile(Attendee &a, vector<UserCredential> &credentials) {
-    viewAttendeeProfile(a);
+string boothLine(const Booth& booth) {
+    string amount = streamDouble(booth.amount);
+    string line;
+    line.reserve(booth.userEmail.size() + booth.venueID.size() + booth.boothID.size() + amount.size() + 5);
+    line += booth.userEmail; line += ',';
+    line += booth.venueID; line += ',';
+    line += booth.boothID; line += ',';
+    line += booth.isRented ? '1' : '0'; line += ',';
+    line += amount;
+    return line;
+}
 
-    cout << "===================================\n";
-    cout << "||  Updating Attendee's Profile  ||\n";
-    cout << "===================================\n\n";
+bool parseBoothLine(const string& line, Booth& b) {
+    stringstream ss(line);
+    string userEmail, venueID, rentedStr, amountStr;
 
-    vector<Attendee> attendees;
-    ifstream inFile("attendees.txt");
-    string line;
+    getline(ss, userEmail, ',');
+    getline(ss, venueID, ',');
+    getline(ss, b.boothID, ',');
+    getline(ss, rentedStr, ',');
+    getline(ss, amountStr);
+    b.userEmail = userEmail;
+    b.venueID = venueID;
 
-    // Load attendees into memory
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        Attendee a;
-        getline(ss, a.id, ',');
-        getline(ss, a.name, ',');
-        getline(ss, a.email, ',');
-        getline(ss, a.password);
-        attendees.push_back(a);
+    try{
+        b.amount = stod(amountStr);
+    }catch(...){
+        b.amount = 0.0;
     }
-    inFile.close();
 
-    for(auto &attendee : attendees) {
-        if(attendee.email == a.email) {
-            cout << "Enter new name (leave blank to keep current): ";
-            string newName; getline(cin, newName);
-            if(!newName.empty()) {
-                a.name = newName;
-                attendee.name = newName;
-            }
+    b.isRented = (rentedStr == "1");
+    return true;
+}
 
-            cout << "Enter new password (leave blank to keep current): ";
-            string newPass; getline(cin, newPass);
-            if(!newPass.empty()) {
-                a.password = newPass;
-                attendee.password = newPass;
-            }
-        }
+void loadBooths(vector<Booth>& booths) {
+    STAT_TIMER(timer, "loadBooths");
+    booths.clear();
+    for (const auto& line : readStoreLines("booth.txt")) {
+        Booth b;
+        parseBoothLine(line, b);
+        booths.push_back(b);
     }
+}
 
-    // Update vector
-    for (auto &cred : credentials) {
-        if (cred.email == a.email && cred.userType == "Attendee") {
-            cred.password = a.password;
-        }
+string sessionLine(const Session& s) {
+    return s.sessionID + "," + s.venueID.str() + "," + s.exhibitorEmail.str() + "," + s.topic + "," + s.timeSlot;
+}
+
+bool parseSessionLine(const string& line, Session& s) {
+    stringstream ss(line);
+    string venueID, exhibitorEmail;
+    getline(ss, s.sessionID, ',');
+    getline(ss, venueID, ',');
+    getline(ss, exhibitorEmail, ',');
+    getline(ss, s.topic, ',');
+    getline(ss, s.timeSlot, ',');
+    s.venueID = venueID;
+    s.exhibitorEmail = exhibitorEmail;
+    return !s.sessionID.empty(); // safety check
+}
+
+void loadSessions(vector<Session>& sessions) {
+    STAT_TIMER(timer, "loadSessions");
+    if (!fileExists("sessions.txt")) {
+        cout << "No sessions found yet.\n";
+        return;
     }
 
-    // Truncate the text file 
-    ofstream outFile("attendees.txt", ios::trunc);
-    for (auto &attendee : attendees) {
-        outFile << attendee.id << "," << attendee.name << "," << attendee.email << "," << attendee.password << "\n";
+    for (const auto& line : readStoreLines("sessions.txt")) {
+        Session s;
+        if (parseSessionLine(line, s)) {
+            sessions.push_back(s);
+        }
     }
-    outFile.close();
+}
 
-    cout << "\n=======================================\n";
-    cout << "|| Profile updated successfully!     ||\n";
-    cout << "=======================================\n";
+string attendeeLine(const Attendee& a) {
+    return a.id + "," + a.name + "," + a.email + "," + a.password;
 }
 
-void deleteAttendeeProfile(Attendee &a) {
-    cout << "\n==============================================================\n";
-    cout << "|| WARNING, ONCE ACCOUNT IS DELETED, ALL DATA WILL BE LOST. ||\n";
-    cout << "==============================================================\n";
+string exhibitorLine(const Exhibitor& e) {
+    return e.id + "," + e.companyName + "," + e.email + "," + e.password;
+}
 
-    string confirmation; 
-    while (true) {
-        cout << "\nAre you sure you want to delete your account? (Y/N): ";
-        getline(cin, confirmation);
+string adminLine(const Admin& ad) {
+    return ad.email + "," + ad.password;
+}
 
-        if(confirmation == "N" || confirmation == "n") {
-            cout << "Returning to dashboard.\n";
-            return;
-        } else if (confirmation == "Y" || confirmation == "y") {
-            break;
-        } else {
-            cout << "Invalid input. Please try again.\n";
-        }
-    }
+bool parseAttendeeLine(const string& line, Attendee& a) {
+    stringstream ss(line);
+    getline(ss, a.id, ',');
+    getline(ss, a.name, ',');
+    getline(ss, a.email, ',');
+    getline(ss, a.password);
+    return true;
+}
 
-    // Rewrite text file
-    ifstream inFile("attendees.txt");
-    if (!inFile.is_open()) {
-        cout << "Error opening attendees.txt\n";
-        return;
-    }
+bool parseExhibitorLine(const string& line, Exhibitor& e) {
+    stringstream ss(line);
+    getline(ss, e.id, ',');
+    getline(ss, e.companyName, ',');
+    getline(ss, e.email, ',');
+    getline(ss, e.password);
+    return true;
+}
 
-    vector<string> attendees;
-    string line;
+bool parseAdminLine(const string& line, Admin& ad) {
+    stringstream ss(line);
+    getline(ss, ad.email, ',');
+    getline(ss, ad.password);
+    return true;
+}
 
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        string id, name, email, password;
-
-        if (getline(ss, id, ',') &&
-            getline(ss, name, ',') &&
-            getline(ss, email, ',') &&
-            getline(ss, password)) 
-        {
-            // Keep only lines that do not match the attendee's email
-            if (email != a.email) {
-                attendees.push_back(line);
-            }
-        }
+void loadAttendees(vector<Attendee>& attendees) {
+    STAT_TIMER(timer, "loadAttendees");
+    attendees.clear();
+    for (const auto& line : readStoreLines("attendees.txt")) {
+        Attendee a;
+        parseAttendeeLine(line, a);
+        attendees.push_back(a);
     }
-    inFile.close();
+}
 
-    ofstream outFile("attendees.txt", ios::trunc);
-    for (const auto& attendee : attendees) {
-        outFile << attendee << "\n";
+void loadExhibitors(vector<Exhibitor>& exhibitors) {
+    STAT_TIMER(timer, "loadExhibitors");
+    exhibitors.clear();
+    for (const auto& line : readStoreLines("exhibitors.txt")) {
+        Exhibitor e;
+        parseExhibitorLine(line, e);
+        exhibitors.push_back(e);
     }
-    outFile.close();
-
 }
 
-void viewExhibitorProfile(Exhibitor &e) {
-    cout << "\n============================================================\n";
-    cout << "||                  EXHIBITOR PROFILE                     ||\n";
-    cout << "============================================================\n";
-    cout << "|| ID          : " << left << setw(41) << e.id << "||\n";
-    cout << "|| Company     : " << left << setw(41) << e.companyName << "||\n";
-    cout << "|| Email       : " << left << setw(41) << e.email << "||\n";
-    cout << "|| Password    : " << left << setw(41) << e.password << "||\n";
-    cout << "============================================================\n\n";
+void loadAdmins(vector<Admin>& admins) {
+    STAT_TIMER(timer, "loadAdmins");
+    admins.clear();
+    for (const auto& line : readStoreLines("admins.txt")) {
+        Admin ad;
+        parseAdminLine(line, ad);
+        admins.push_back(ad);
+    }
 }
 
-void updateExhibitorProfile(Exhibitor &e, vector<UserCredential> &credentials) {
-    viewExhibitorProfile(e);
+// ==========================
+// DATA STORE
+// ==========================
+// One resident copy of every collection. A collection is read from disk the
+// first time it is used; after that handlers work on memory, log each change
+// and mark the collection dirty. Checkpoints write dirty collections straight
+// from memory, so nothing is re-read from disk during normal operation.
+// Handlers change memory before logging: a log write may trigger that
+// checkpoint, and it must already see the change.
+enum Collection {
+    TICKETS,
+    BOOTHS,
+    SESSIONS,
+    VENUES,
+    CREDENTIALS,
+    ANNOUNCEMENTS,
+    FEEDBACK,
+    COLLECTION_COUNT
+};
 
-    cout << "====================================\n";
-    cout << "||  Updating Exhibitor's Profile  ||\n";
-    cout << "====================================\n\n";
+// One bit per booth grid cell, set while the booth is rented
+typedef bitset<MAX_BOOTH_ROWS * MAX_BOOTH_COLS> BoothOccupancy;
+
+// Session time slots of one venue as minute ranges: start -> (end, sessionID)
+typedef multimap<int, pair<int, string>> VenueSchedule;
+
+struct CredentialEntry {
+    size_t credential = SIZE_MAX;
+    size_t profile = SIZE_MAX;
+};
 
+struct DataStore {
+    vector<Ticket> tickets;
+    vector<Booth> booths;
+    vector<Session> sessions;
+    vector<Venue> venues;
+    vector<UserCredential> credentials;
+    vector<Attendee> attendees;
     vector<Exhibitor> exhibitors;
-    ifstream inFile("exhibitors.txt");
-    string line;
+    vector<Admin> admins;
+    vector<Announcement> announcements;
+    vector<Feedback> feedbacks;
 
-    // Load exhibitor into memory
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        Exhibitor e;
-        getline(ss, e.id, ',');
-        getline(ss, e.companyName, ',');
-        getline(ss, e.email, ',');
-        getline(ss, e.password);
-        exhibitors.push_back(e);
-    }
-    inFile.close();
+    // Positions in tickets and booths for each user email, by its handle
+    unordered_map<uint32_t, vector<size_t>> ticketsByUser;
+    unordered_map<uint32_t, vector<size_t>> boothsByUser;
 
-    for(auto &exhibitor : exhibitors) {
-        if(exhibitor.email == e.email) {
-            cout << "Enter new company name (leave blank to keep current): ";
-            string newName; getline(cin, newName);
-            if(!newName.empty()) {
-                e.companyName = newName;
-                exhibitor.companyName= newName;
-            }
+    // Rented booth cells for each venue ID
+    unordered_map<string, BoothOccupancy> boothOccupancy;
 
-            cout << "Enter new password (leave blank to keep current): ";
-            string newPass; getline(cin, newPass);
-            if(!newPass.empty()) {
-                e.password = newPass;
-                exhibitor.password = newPass;
-            }
-        }
+    // Scheduled session slots for each venue ID, sorted by start minute
+    unordered_map<string, VenueSchedule> sessionSchedule;
+
+    // Position of each account in credentials and in its role's profile list
+    unordered_map<string, CredentialEntry> credentialIndex;
+
+    // Generation of each data file as of loading its collection, see
+    // CROSS-PROCESS LOCKING
+    map<string, uint64_t> generations;
+
+    bool loaded[COLLECTION_COUNT] = {};
+    bool dirty[COLLECTION_COUNT] = {};
+};
+
+DataStore store;
+
+// Concurrent sales (server mode, stress test): purchases and booth rentals
+// hold storeMutex shared and lock only their own inventory stripe, so sales
+// for different venues and ticket types run in parallel. Every other
+// operation holds storeMutex exclusively. The shared ticket and booth lists
+// are appended to under appendMutex.
+shared_mutex storeMutex;
+mutex appendMutex;
+
+const size_t INVENTORY_STRIPES = 256;
+mutex inventoryStripes[INVENTORY_STRIPES];
+
+// Each venue has one stripe per ticket type slot plus one for its booths
+mutex& ticketTypeLock(size_t venueIndex, size_t typeIndex) {
+    return inventoryStripes[(venueIndex * (MAX_TICKET_TYPES + 1) + typeIndex) % INVENTORY_STRIPES];
+}
+
+mutex& venueBoothLock(size_t venueIndex) {
+    return inventoryStripes[(venueIndex * (MAX_TICKET_TYPES + 1) + MAX_TICKET_TYPES) % INVENTORY_STRIPES];
+}
+
+// Atomic inventory mode, for flash sales where one ticket type is hot enough
+// that even its own stripe queues buyers: each ticket type's remaining seats
+// live in an atomic counter that purchases reserve with compare-and-swap.
+// While it is on, purchases leave TicketType::sold alone; the counters are
+// settled back into the venues whenever storeMutex is held exclusively.
+// A reservation counts seats whose tickets may not be logged yet, so the
+// sold count the log records comes from ticketsLogged instead, advanced in
+// the same log write as the tickets.
+bool atomicInventory = false;
+unique_ptr<atomic<int>[]> ticketsLeft;
+unique_ptr<atomic<int>[]> ticketsLogged;
+
+atomic<int>& ticketsLeftFor(size_t venueIndex, size_t typeIndex) {
+    return ticketsLeft[venueIndex * MAX_TICKET_TYPES + typeIndex];
+}
+
+atomic<int>& ticketsLoggedFor(size_t venueIndex, size_t typeIndex) {
+    return ticketsLogged[venueIndex * MAX_TICKET_TYPES + typeIndex];
+}
+
+// Takes qty seats, all or none. Fails once fewer than qty are left, so
+// the counter never goes below zero.
+bool reserveTickets(atomic<int>& left, int qty) {
+    int current = left.load(memory_order_relaxed);
+    do {
+        if (current < qty) return false;
+    } while (!left.compare_exchange_weak(current, current - qty, memory_order_acq_rel, memory_order_relaxed));
+    return true;
+}
+
+void releaseTickets(size_t venueIndex, size_t typeIndex, int qty) {
+    if (!atomicInventory) return;
+    ticketsLeftFor(venueIndex, typeIndex).fetch_add(qty, memory_order_acq_rel);
+    ticketsLoggedFor(venueIndex, typeIndex).fetch_sub(qty, memory_order_relaxed);
+}
+
+// Resets a venue's counters from its ticket types, after an event opens or
+// closes. Call with storeMutex held exclusively.
+void syncTicketInventory(size_t venueIndex) {
+    if (!atomicInventory) return;
+    const vector<TicketType>& types = store.venues[venueIndex].ticketType;
+    for (size_t ti = 0; ti < (size_t)MAX_TICKET_TYPES; ++ti) {
+        int left = ti < types.size() ? types[ti].capacity - types[ti].sold : 0;
+        ticketsLeftFor(venueIndex, ti).store(max(left, 0));
+        ticketsLoggedFor(venueIndex, ti).store(ti < types.size() ? types[ti].sold : 0);
     }
+}
 
-    // Update vector
-    for (auto &cred : credentials) {
-        if (cred.email == e.email && cred.userType == "Attendee") {
-            cred.password = e.password;
+// A ticket type with the sales logged since the last settle
+TicketType countedTicketType(size_t venueIndex, size_t typeIndex) {
+    TicketType tt = store.venues[venueIndex].ticketType[typeIndex];
+    if (atomicInventory) {
+        int sold = ticketsLoggedFor(venueIndex, typeIndex).load(memory_order_acquire);
+        tt.revenue += (sold - tt.sold) * tt.price;
+        tt.sold = sold;
+    }
+    return tt;
+}
+
+// The ticket type as the log records it once qty more seats are logged.
+// Call from the walWrite counter callback, under walMutex, so the counts
+// reach the log in order and never include a seat whose ticket is not there.
+TicketType loggedTicketType(size_t venueIndex, size_t typeIndex, int qty) {
+    TicketType tt = store.venues[venueIndex].ticketType[typeIndex];
+    int sold = ticketsLoggedFor(venueIndex, typeIndex).fetch_add(qty, memory_order_relaxed) + qty;
+    tt.revenue += (sold - tt.sold) * tt.price;
+    tt.sold = sold;
+    return tt;
+}
+
+// Call with storeMutex held exclusively, before anything reads sold counts
+void settleTicketInventory() {
+    if (!atomicInventory) return;
+    for (size_t vi = 0; vi < store.venues.size(); ++vi) {
+        for (size_t ti = 0; ti < store.venues[vi].ticketType.size(); ++ti) {
+            store.venues[vi].ticketType[ti] = countedTicketType(vi, ti);
         }
     }
+}
 
-    // Truncate the text file 
-    ofstream outFile("exhibitors.txt", ios::trunc);
-    for (auto &exhibitor : exhibitors) {
-        outFile << exhibitor.id << "," << exhibitor.companyName<< "," << exhibitor.email << "," << exhibitor.password << "\n";
+void rebuildTicketIndex() {
+    store.ticketsByUser.clear();
+    for (size_t i = 0; i < store.tickets.size(); ++i) {
+        store.ticketsByUser[store.tickets[i].userEmail.id].push_back(i);
     }
-    outFile.close();
+}
 
-    cout << "\n=======================================\n";
-    cout << "|| Profile updated successfully!     ||\n";
-    cout << "=======================================\n";
+void setBoothOccupied(const string& venueID, const string& boothID, bool rented) {
+    int row, col;
+    if (!boothGridPosition(boothID, row, col)) return;
+    store.boothOccupancy[venueID].set(boothGridIndex(row, col), rented);
 }
 
-void deleteExhibitorProfile(Exhibitor &e) {
-    cout << "\n==============================================================\n";
-    cout << "|| WARNING, ONCE ACCOUNT IS DELETED, ALL DATA WILL BE LOST. ||\n";
-    cout << "==============================================================\n";
+void rebuildBoothIndex() {
+    store.boothsByUser.clear();
+    store.boothOccupancy.clear();
+    // Every venue gets its entry up front, so concurrent rentals only ever
+    // change existing bitsets and never insert into the map
+    if (store.loaded[VENUES]) {
+        for (const auto& v : store.venues) store.boothOccupancy[v.venueID];
+    }
+    for (size_t i = 0; i < store.booths.size(); ++i) {
+        const Booth& b = store.booths[i];
+        store.boothsByUser[b.userEmail.id].push_back(i);
+        if (b.isRented) setBoothOccupied(b.venueID, b.boothID, true);
+    }
+}
 
-    string confirmation; 
-    while (true) {
-        cout << "\nAre you sure you want to delete your account? (Y/N): ";
-        getline(cin, confirmation);
+void addSessionSlot(const Session& s) {
+    int start, end;
+    if (!parseTimeSlot(s.timeSlot, start, end)) return;
+    store.sessionSchedule[s.venueID].insert({start, {end, s.sessionID}});
+}
 
-        if(confirmation == "N" || confirmation == "n") {
-            cout << "Returning to dashboard.\n";
+void removeSessionSlot(const Session& s) {
+    int start, end;
+    if (!parseTimeSlot(s.timeSlot, start, end)) return;
+    VenueSchedule& schedule = store.sessionSchedule[s.venueID];
+    auto range = schedule.equal_range(start);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.second == s.sessionID) {
+            schedule.erase(it);
             return;
-        } else if (confirmation == "Y" || confirmation == "y") {
-            break;
-        } else {
-            cout << "Invalid input. Please try again.\n";
         }
     }
+}
 
-    // Rewrite text file
-    ifstream inFile("exhibitors.txt");
-    if (!inFile.is_open()) {
-        cout << "Error opening exhibitors.txt\n";
-        return;
-    }
+void rebuildSessionIndex() {
+    store.sessionSchedule.clear();
+    for (const auto& s : store.sessions) addSessionSlot(s);
+}
 
-    vector<string> exhibitors;
-    string line;
+// Accounts are keyed by role and email, e.g. "Attendee:a@b.com"
+string credentialKey(const string& role, const string& email) {
+    return role + ":" + email;
+}
 
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        string id, name, email, password;
-
-        if (getline(ss, id, ',') &&
-            getline(ss, name, ',') &&
-            getline(ss, email, ',') &&
-            getline(ss, password)) 
-        {
-            // Keep only lines that do not match the attendee's email
-            if (email != e.email) {
-                exhibitors.push_back(line);
-            }
-        }
+void rebuildCredentialIndex() {
+    store.credentialIndex.clear();
+    for (size_t i = 0; i < store.credentials.size(); ++i) {
+        const UserCredential& c = store.credentials[i];
+        store.credentialIndex[credentialKey(c.userType, c.email)].credential = i;
+    }
+    for (size_t i = 0; i < store.attendees.size(); ++i) {
+        store.credentialIndex[credentialKey("Attendee", store.attendees[i].email)].profile = i;
+    }
+    for (size_t i = 0; i < store.exhibitors.size(); ++i) {
+        store.credentialIndex[credentialKey("Exhibitor", store.exhibitors[i].email)].profile = i;
+    }
+    for (size_t i = 0; i < store.admins.size(); ++i) {
+        store.credentialIndex[credentialKey("Admin", store.admins[i].email)].profile = i;
     }
-    inFile.close();
+}
 
-    ofstream outFile("exhibitors.txt", ios::trunc);
-    for (const auto& exhibitor : exhibitors) {
-        outFile << exhibitor << "\n";
+// Points the index entry for a record moved from one position to another
+void moveIndexedPosition(vector<size_t>& positions, size_t from, size_t to) {
+    for (auto& p : positions) {
+        if (p == from) {
+            p = to;
+            return;
+        }
     }
-    outFile.close();
+}
 
+// Deletes and replacements are logged with the line rendered from memory, so a
+// file whose lines do not render back identically (hand edits, the old
+// multi-line feedback format) is logged over once in canonical form.
+void normalizeStoreFile(const string& filename) {
+    vector<string> rendered;
+    renderResidentStore(filename, rendered);
+    if (rendered != readStoreLines(filename)) {
+        saveStoreLines(filename, rendered);
+    }
 }
 
-void viewAdminProfile(Admin &ad) {
-    cout << "\n============================================================\n";
-    cout << "||                     ADMIN PROFILE                      ||\n";
-    cout << "============================================================\n";
-    cout << "|| Email     : " << left << setw(43) << ad.email << "||\n";
-    cout << "|| Password  : " << left << setw(43) << ad.password << "||\n";
-    cout << "============================================================\n\n";
+vector<string> collectionFiles(Collection c) {
+    switch (c) {
+        case TICKETS: return {"ticket.txt"};
+        case BOOTHS: return {"booth.txt"};
+        case SESSIONS: return {"sessions.txt"};
+        case VENUES: return {VENUE_DATA_FILE};
+        case CREDENTIALS: return {"attendees.txt", "exhibitors.txt", "admins.txt"};
+        case ANNOUNCEMENTS: return {"announcements.txt"};
+        case FEEDBACK: return {"feedback.txt"};
+        default: return {};
+    }
 }
 
-void updateAdminProfile(Admin &ad, vector<UserCredential> &credentials) {
-    viewAdminProfile(ad);
+bool loadSnapshot(Collection c);
+
+void ensureLoaded(Collection c) {
+    if (store.loaded[c]) return;
+    // The generations are taken first: a change that lands while loading
+    // only makes the copy look stale, never current
+    StoreFileLock storeFiles;
+    for (const auto& filename : collectionFiles(c)) store.generations[filename] = diskGeneration(filename);
+    bool fromSnapshot = loadSnapshot(c);
+    switch (c) {
+        case TICKETS: if (!fromSnapshot) loadTickets(store.tickets); rebuildTicketIndex(); break;
+        case BOOTHS: if (!fromSnapshot) loadBooths(store.booths); rebuildBoothIndex(); break;
+        case SESSIONS:
+            if (!fromSnapshot) {
+                store.sessions.clear();
+                loadSessions(store.sessions);
+            }
+            rebuildSessionIndex();
+            break;
+        case VENUES: loadVenues(store.venues); break;
+        case CREDENTIALS:
+            if (!fromSnapshot) {
+                loadCredentials(store.credentials);
+                loadAttendees(store.attendees);
+                loadExhibitors(store.exhibitors);
+                loadAdmins(store.admins);
+            }
+            rebuildCredentialIndex();
+            break;
+        case ANNOUNCEMENTS: if (!fromSnapshot) loadAnnouncements(store.announcements); break;
+        case FEEDBACK: if (!fromSnapshot) store.feedbacks = loadFeedbacks(); break;
+        default: break;
+    }
+    store.loaded[c] = true;
+
+    // A snapshot is only taken of files this program wrote or already checked
+    if (fromSnapshot) return;
+
+    // The small, hand-editable files are checked; tickets and booths are
+    // only ever written by this program
+    switch (c) {
+        case SESSIONS: normalizeStoreFile("sessions.txt"); break;
+        case CREDENTIALS:
+            normalizeStoreFile("attendees.txt");
+            normalizeStoreFile("exhibitors.txt");
+            normalizeStoreFile("admins.txt");
+            break;
+        case ANNOUNCEMENTS: normalizeStoreFile("announcements.txt"); break;
+        case FEEDBACK: normalizeStoreFile("feedback.txt"); break;
+        default: break;
+    }
+}
 
-    cout << "================================\n";
-    cout << "||  Updating Admin's Profile  ||\n";
-    cout << "================================\n\n";
+vector<Ticket>& storeTickets() { ensureLoaded(TICKETS); return store.tickets; }
+vector<Booth>& storeBooths() { ensureLoaded(BOOTHS); return store.booths; }
+vector<Session>& storeSessions() { ensureLoaded(SESSIONS); return store.sessions; }
+vector<Venue>& storeVenues() { ensureLoaded(VENUES); return store.venues; }
+vector<UserCredential>& storeCredentials() { ensureLoaded(CREDENTIALS); return store.credentials; }
+vector<Announcement>& storeAnnouncements() { ensureLoaded(ANNOUNCEMENTS); return store.announcements; }
+vector<Feedback>& storeFeedbacks() { ensureLoaded(FEEDBACK); return store.feedbacks; }
 
-    vector<Admin> admins;
-    ifstream inFile("admins.txt");
-    string line;
+void markDirty(Collection c) {
+    store.dirty[c] = true;
+}
 
-    // Load admin into memory
-    while (getline(inFile, line)) {
-        stringstream ss(line);
-        Admin ad;
-        getline(ss, ad.email, ',');
-        getline(ss, ad.password);
-        admins.push_back(ad);
+bool collectionStale(Collection c) {
+    if (!store.loaded[c]) return false;
+    for (const auto& filename : collectionFiles(c)) {
+        auto loadedAt = store.generations.find(filename);
+        uint64_t generation = loadedAt == store.generations.end() ? 0 : loadedAt->second;
+        if (generation != diskGeneration(filename)) return true;
     }
-    inFile.close();
+    return false;
+}
 
-    for(auto &admin : admins) {
-        if(admin.email == ad.email) {
-            cout << "Enter new password (leave blank to keep current): ";
-            string newPass; getline(cin, newPass);
-            if(!newPass.empty()) {
-                ad.password = newPass;
-                admin.password = newPass;
-            }
+// Reloads the collections an operation reads that another copy of the
+// program changed since they were loaded, so the operation checks stock,
+// clashes and ownership against the current files. Collections nobody
+// else touched are left alone. Call with the store files locked and, in
+// the server, storeMutex held exclusively.
+void syncCollections(initializer_list<Collection> reads) {
+    for (Collection c : reads) {
+        if (!collectionStale(c)) continue;
+        STAT_TIMER(timer, "stale reload");
+        store.loaded[c] = false;
+        ensureLoaded(c);
+        if (c == VENUES) {
+            for (size_t vi = 0; vi < store.venues.size(); ++vi) syncTicketInventory(vi);
         }
     }
+}
 
-    // Update vector
-    for (auto &cred : credentials) {
-        if (cred.email == ad.email && cred.userType == "Attendee") {
-            cred.password = ad.password;
-        }
-    }
+// For menus, so the choices shown include other kiosks' changes. What the
+// user picks is checked again when it is committed.
+void refreshCollections(initializer_list<Collection> reads) {
+    StoreFileLock storeFiles;
+    syncCollections(reads);
+}
+
+void syncLoadedCollections() {
+    syncCollections({TICKETS, BOOTHS, SESSIONS, VENUES, CREDENTIALS, ANNOUNCEMENTS, FEEDBACK});
+}
 
-    // Truncate the text file 
-    ofstream outFile("admins.txt", ios::trunc);
-    for (auto &admin : admins) {
-        outFile << admin.email << "," << admin.password << "\n";
+bool anyCollectionStale() {
+    for (int c = 0; c < COLLECTION_COUNT; ++c) {
+        if (collectionStale(Collection(c))) return true;
     }
-    outFile.close();
+    return false;
+}
 
-    cout << "\n=======================================\n";
-    cout << "|| Profile updated successfully!     ||\n";
-    cout << "=======================================\n";
+// A copy that was current on a file it just wrote is current on the new
+// generation as well
+void generationsCommitted(const set<string>& files, const map<string, uint64_t>& before) {
+    for (const auto& filename : files) {
+        auto loadedAt = store.generations.find(filename);
+        auto previous = before.find(filename);
+        uint64_t was = previous == before.end() ? 0 : previous->second;
+        if (loadedAt != store.generations.end() && loadedAt->second == was) loadedAt->second = was + 1;
+    }
 }
 
-// ==========================
-// MARKETING MODULE (ANNOUNCEMENT)
-// ==========================
-void postAnnouncement(vector<Announcement>& announcements) {
-    Announcement a;
+thread compactorThread;
+bool compactorStopping = false;
 
-    cout << "======================================\n";
-    cout << "||        Post Announcement         ||\n";
-    cout << "======================================\n";
-    cout << "|| Select the recipient user type:  ||\n";
-    cout << "|| 1. Attendee                      ||\n";
-    cout << "|| 2. Exhibitor                     ||\n";
-    cout << "|| 3. Both                          ||\n";
-    cout << "|| 0. Back                          ||\n";
-    cout << "======================================\n";
-    
-    int choice = getValidatedChoice(0, 3, "Choice: "); 
+// Runs a checkpoint that a concurrent log write marked due. Call with
+// storeMutex not held.
+void runDueCheckpoint() {
+    if (!checkpointDue) return;
+    unique_lock<shared_mutex> lock(storeMutex);
+    if (checkpointDue.exchange(false)) checkpointStores();
+}
 
-    if(choice == 0) return;
-    else if (choice == 1) a.userType = "Attendee";
-    else if (choice == 2) a.userType = "Exhibitor";
-    else a.userType = "Both";
+// While sales run concurrently, compaction runs on its own thread, so no
+// request waits for the stores to be rewritten
+void startBackgroundCompaction() {
+    compactorStopping = false;
+    compactorThread = thread([] {
+        unique_lock<mutex> lock(compactorMutex);
+        while (true) {
+            compactionWanted.wait(lock, [] { return checkpointDue || compactorStopping; });
+            if (compactorStopping) return;
+            lock.unlock();
+            runDueCheckpoint();
+            lock.lock();
+        }
+    });
+}
 
-    while(true)
+// A compaction still due is left to the next flushStore
+void stopBackgroundCompaction() {
     {
-        cout << "Enter title (Maximum 20 Characters): ";
-        getline(cin, a.title);
+        lock_guard<mutex> lock(compactorMutex);
+        compactorStopping = true;
+        compactionWanted.notify_one();
+    }
+    compactorThread.join();
+}
 
-        if(a.title == "") {
-            cout << "Title cannot be empty. Please try again.\n\n";
-        } else {
-            if(a.title.length() <= 20) {
-                break;
-            } else {
-                cout << "Title has more than 20 characters. Please try again.\n\n";
-            }
-        }
-
-    }
+// Loads everything up front before sales start running concurrently, since
+// a lazy load from two threads at once would race
+void prepareConcurrentSales(bool atomicTickets = false) {
+    // Sales threads must find nothing stale: a reload under the shared lock
+    // would race with them
+    StoreFileLock storeFiles;
+    for (int c = 0; c < COLLECTION_COUNT; ++c) ensureLoaded(Collection(c));
+    syncLoadedCollections();
+    // Files never written yet have no entry; adding them later from a
+    // sales thread would race on the map
+    for (int c = 0; c < COLLECTION_COUNT; ++c) {
+        for (const auto& filename : collectionFiles(Collection(c))) {
+            store.generations.emplace(filename, diskGeneration(filename));
+        }
+    }
+    rebuildBoothIndex();
+    deferCheckpoints = true;
+    startBackgroundCompaction();
+
+    vector<string> files;
+    for (int c = 0; c < COLLECTION_COUNT; ++c) {
+        for (const auto& filename : collectionFiles(Collection(c))) files.push_back(filename);
+    }
+    startLingeringStoreLock(files);
+
+    atomicInventory = atomicTickets;
+    ticketsLeft.reset(atomicTickets ? new atomic<int>[store.venues.size() * MAX_TICKET_TYPES] : nullptr);
+    ticketsLogged.reset(atomicTickets ? new atomic<int>[store.venues.size() * MAX_TICKET_TYPES] : nullptr);
+    for (size_t vi = 0; atomicTickets && vi < store.venues.size(); ++vi) syncTicketInventory(vi);
+}
 
-    cout << endl;
-    
-    while(true)
-    {
-        cout << "Enter content (Maximum 50 Characters): ";
-        getline(cin, a.content);
+// Back to single-threaded use: settles the counters and stops deferring
+// checkpoints. Call once the sales threads are done, with storeMutex not held.
+void endConcurrentSales() {
+    stopBackgroundCompaction();
+    settleTicketInventory();
+    atomicInventory = false;
+    ticketsLeft.reset();
+    ticketsLogged.reset();
+    deferCheckpoints = false;
+    stopLingeringStoreLock();
+}
 
-        if(a.content == "") {
-            cout << "Content cannot be empty. Please try again.\n\n";
-        } else {
-            if(a.content.length() <= 50) {
+// One pass over every ticket and booth, used when venues.dat has no stored
+// totals yet or recovery cut a unit short
+void rebuildVenueTotals(vector<Venue>& venues) {
+    unordered_map<string, size_t> byEvent, byVenueID;
+    for (size_t i = 0; i < venues.size(); ++i) {
+        Venue& v = venues[i];
+        for (auto& tt : v.ticketType) {
+            tt.sold = 0;
+            tt.revenue = 0;
+        }
+        v.boothsRented = 0;
+        v.boothRevenue = 0;
+        if (!v.eventName.empty()) byEvent[v.eventName] = i;
+        byVenueID[v.venueID] = i;
+    }
+
+    for (const auto& t : storeTickets()) {
+        auto it = byEvent.find(t.eventName);
+        if (it == byEvent.end()) continue;
+        for (auto& tt : venues[it->second].ticketType) {
+            if (tt.type == t.ticketType) {
+                tt.sold++;
+                tt.revenue += t.amount;
                 break;
-            } else {
-                cout << "Content has more than 50 characters. Please try again.\n\n";
             }
         }
-
     }
-
-    // Assign new index
-    int maxIndex = 0;
-    for (auto& an : announcements) {
-        if (an.index > maxIndex) maxIndex = an.index;
+    for (const auto& b : storeBooths()) {
+        auto it = byVenueID.find(b.venueID);
+        if (it == byVenueID.end() || !b.isRented) continue;
+        venues[it->second].boothsRented++;
+        venues[it->second].boothRevenue += b.amount;
     }
-    a.index = maxIndex + 1;
-
-    announcements.push_back(a);
-    saveAnnouncements(announcements);
+}
 
-    cout << "\n======================================\n";
-    cout << "|| Announcement posted!!!!          ||\n";
-    cout << "======================================\n";
+const vector<size_t>& userTicketPositions(const string& email) {
+    static const vector<size_t> none;
+    ensureLoaded(TICKETS);
+    auto it = store.ticketsByUser.find(Symbol::existing(email).id);
+    return it == store.ticketsByUser.end() ? none : it->second;
+}
 
+const vector<size_t>& userBoothPositions(const string& email) {
+    static const vector<size_t> none;
+    ensureLoaded(BOOTHS);
+    auto it = store.boothsByUser.find(Symbol::existing(email).id);
+    return it == store.boothsByUser.end() ? none : it->second;
 }
 
-void viewAnnouncement(const vector<Announcement>& announcements, const string& userType) {
-    
-    cout << "======================================\n";
-    cout << "||       View Announcements         ||\n";
-    cout << "======================================\n";
-    if (announcements.empty()) {
-        cout << "|| No announcements available.       ||\n";
-        cout << "======================================\n";
-        
-        return;
-    }
+// Concurrent sales call the two below with appendMutex held
+void addStoreTicket(const Ticket& t) {
+    vector<Ticket>& tickets = storeTickets();
+    store.ticketsByUser[t.userEmail.id].push_back(tickets.size());
+    tickets.push_back(t);
+}
 
-    if (userType == "Admin") {
-        cout << "|| Select the usertype              ||\n";
-        cout << "|| 1. Attendee                      ||\n";
-        cout << "|| 2. Exhibitor                     ||\n";
-        cout << "|| 3. Both                          ||\n";
-        cout << "|| 0. Back                          ||\n";
-        cout << "======================================\n";
-        int choice = getValidatedChoice(0,3, "Choice: ");
+// Removes by moving the last ticket into the hole, so only two index entries change
+void removeStoreTicket(size_t pos) {
+    vector<Ticket>& tickets = storeTickets();
+    size_t last = tickets.size() - 1;
 
-        cout << endl;
+    vector<size_t>& owner = store.ticketsByUser[tickets[pos].userEmail.id];
+    owner.erase(find(owner.begin(), owner.end(), pos));
+    if (owner.empty()) store.ticketsByUser.erase(tickets[pos].userEmail.id);
 
-        if (choice == 0) { return; }
+    if (pos != last) {
+        moveIndexedPosition(store.ticketsByUser[tickets[last].userEmail.id], last, pos);
+        tickets[pos] = move(tickets[last]);
+    }
+    tickets.pop_back();
+}
 
-        string filterType;
-        if (choice == 1) filterType = "Attendee";
-        else if (choice == 2) filterType = "Exhibitor";
-        else filterType = "Both";
+const CredentialEntry* findCredential(const string& role, const string& email) {
+    ensureLoaded(CREDENTIALS);
+    auto it = store.credentialIndex.find(credentialKey(role, email));
+    return it == store.credentialIndex.end() ? nullptr : &it->second;
+}
 
-        bool found = false;
-        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-        cout << "||               Current Announcements for " << left << setw(13) << filterType << "       ||\n";
-        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-        for (const auto& ann : announcements) {
-            if (ann.userType == filterType || ann.userType == "Both" || filterType == "Both") {
-                cout << "|| Index: " << left << setw(52) << ann.index << " ||\n";
-                cout << "|| User Type: " << left << setw(48) << ann.userType << " ||\n";
-                cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
-                cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
-                cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-                found = true;
-            }
-        }
-        if (!found) {
-            cout << "======================================\n";
-            cout << "||     No announcements found       ||\n";
-            cout << "======================================\n";
-        }
-    }
-    else {
-        bool found = false;
-        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-        cout << "||               Current Announcements for " << left << setw(13) << userType << "       ||\n";
-        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-        for (const auto& ann : announcements) {
-            if (ann.userType == userType || ann.userType == "Both") {
-                cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
-                cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
-                cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-                found = true;
-            }
-        }
-        if (!found) {
-            cout << "======================================\n";
-            cout << "||     No announcements found       ||\n";
-            cout << "======================================\n";
-        }
+// Signing up requires an email unused by every role
+bool emailRegistered(const string& email) {
+    for (const string role : {"Attendee", "Exhibitor", "Admin"}) {
+        const CredentialEntry* entry = findCredential(role, email);
+        if (entry && entry->credential != SIZE_MAX) return true;
     }
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
-    
+    return false;
 }
 
-void editAnnouncement(vector<Announcement>& announcements) {
-    
-    cout << "======================================\n";
-    cout << "||        Edit Announcement         ||\n";
-    cout << "======================================\n";
-    if (announcements.empty()) {
-        cout << "|| No announcements available.       ||\n";
-        cout << "======================================\n";
-        
-        return;
+// Call after pushing the account's credential and profile
+void indexNewAccount(const string& role, const string& email, size_t profile) {
+    CredentialEntry& entry = store.credentialIndex[credentialKey(role, email)];
+    entry.credential = store.credentials.size() - 1;
+    entry.profile = profile;
+}
+
+template <typename Profile>
+void removeProfileAt(vector<Profile>& profiles, size_t pos, const string& role) {
+    size_t last = profiles.size() - 1;
+    if (pos != last) {
+        profiles[pos] = move(profiles[last]);
+        store.credentialIndex[credentialKey(role, profiles[pos].email)].profile = pos;
     }
+    profiles.pop_back();
+}
 
-    cout << "|| Select the usertype:             ||\n";
-    cout << "|| 1. Attendee                      ||\n";
-    cout << "|| 2. Exhibitor                     ||\n";
-    cout << "|| 3. Both                          ||\n";
-    cout << "|| 0. Back                          ||\n";
-    cout << "======================================\n";
-    int choice = getValidatedChoice(0, 3, "Choice: ");    
+// Removes an account's credential and profile, moving the last entry of
+// each vector into the freed slot
+template <typename Profile>
+void removeAccount(vector<Profile>& profiles, const string& role, const string& email) {
+    auto it = store.credentialIndex.find(credentialKey(role, email));
+    if (it == store.credentialIndex.end()) return;
+    CredentialEntry entry = it->second;
+    store.credentialIndex.erase(it);
+
+    if (entry.credential != SIZE_MAX) {
+        auto& credentials = store.credentials;
+        size_t last = credentials.size() - 1;
+        if (entry.credential != last) {
+            credentials[entry.credential] = move(credentials[last]);
+            const UserCredential& moved = credentials[entry.credential];
+            store.credentialIndex[credentialKey(moved.userType, moved.email)].credential = entry.credential;
+        }
+        credentials.pop_back();
+    }
+    if (entry.profile != SIZE_MAX) removeProfileAt(profiles, entry.profile, role);
+}
 
-    cout << endl;
+// Scheduled slots in a venue never overlap, so only the slot starting
+// closest before the new end can clash. ignoreID skips the session being
+// moved by an update.
+bool sessionSlotClashes(const string& venueID, int start, int end, const string& ignoreID = "") {
+    ensureLoaded(SESSIONS);
+    auto found = store.sessionSchedule.find(venueID);
+    if (found == store.sessionSchedule.end()) return false;
+    const VenueSchedule& schedule = found->second;
+
+    auto it = schedule.lower_bound(end);
+    while (it != schedule.begin()) {
+        --it;
+        if (it->second.second == ignoreID) continue;
+        return it->second.first > start;
+    }
+    return false;
+}
 
-    if (choice == 0) { return; }
+// Gaps between a venue's sessions within the day, as minute ranges
+vector<pair<int, int>> freeSessionSlots(const string& venueID) {
+    const int dayEnd = 23 * 60 + 59;
+    ensureLoaded(SESSIONS);
+    vector<pair<int, int>> gaps;
+    int cursor = 0;
+    auto found = store.sessionSchedule.find(venueID);
+    if (found != store.sessionSchedule.end()) {
+        for (const auto& slot : found->second) {
+            if (slot.first > cursor) gaps.push_back({cursor, slot.first});
+            cursor = max(cursor, slot.second.first);
+        }
+    }
+    if (cursor < dayEnd) gaps.push_back({cursor, dayEnd});
+    return gaps;
+}
 
-    string filterType;
-    if (choice == 1) filterType = "Attendee";
-    else if (choice == 2) filterType = "Exhibitor";
-    else filterType = "Both";
+void addStoreBooth(const Booth& b) {
+    vector<Booth>& booths = storeBooths();
+    store.boothsByUser[b.userEmail.id].push_back(booths.size());
+    if (b.isRented) setBoothOccupied(b.venueID, b.boothID, true);
+    booths.push_back(b);
+}
 
-    bool found = false;
-    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-    cout << "||               Current Announcements for " << left << setw(13) << filterType << "       ||\n";
-    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-    for (const auto& ann : announcements) {
-        if (ann.userType == filterType || ann.userType == "Both" || filterType == "Both") {
-            cout << "|| Index: " << left << setw(52) << ann.index << " ||\n";
-            cout << "|| User Type: " << left << setw(48) << ann.userType << " ||\n";
-            cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
-            cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
-            cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-            found = true;
-        }
-    }
-    if (!found) {
-        cout << "======================================\n";
-        cout << "||     No announcements found       ||\n";
-        cout << "======================================\n";
-        
-        return;
-    }
+const BoothOccupancy& venueOccupancy(const string& venueID) {
+    static const BoothOccupancy none;
+    ensureLoaded(BOOTHS);
+    auto it = store.boothOccupancy.find(venueID);
+    return it == store.boothOccupancy.end() ? none : it->second;
+}
 
-    int index;
+bool isBoothOccupied(const string& venueID, const string& boothID) {
+    int row, col;
+    if (!boothGridPosition(boothID, row, col)) return false;
+    return venueOccupancy(venueID).test(boothGridIndex(row, col));
+}
 
-    while (true) {
-        cout << "\nEnter the index of the announcement to edit (or 0 to go back): ";
+// Renders a data file from memory for the checkpoint. Returns false when the
+// file is not held by a loaded collection, in which case the log is replayed.
+bool renderResidentStore(const string& filename, vector<string>& lines) {
+    if (filename == "ticket.txt" && store.loaded[TICKETS]) {
+        for (const auto& t : store.tickets) lines.push_back(ticketLine(t));
+    } else if (filename == "booth.txt" && store.loaded[BOOTHS]) {
+        for (const auto& b : store.booths) lines.push_back(boothLine(b));
+    } else if (filename == "sessions.txt" && store.loaded[SESSIONS]) {
+        for (const auto& s : store.sessions) lines.push_back(sessionLine(s));
+    } else if (filename == "announcements.txt" && store.loaded[ANNOUNCEMENTS]) {
+        for (const auto& a : store.announcements) lines.push_back(announcementLine(a));
+    } else if (filename == "feedback.txt" && store.loaded[FEEDBACK]) {
+        for (const auto& fb : store.feedbacks) lines.push_back(feedbackLine(fb));
+    } else if (filename == "attendees.txt" && store.loaded[CREDENTIALS]) {
+        for (const auto& a : store.attendees) lines.push_back(attendeeLine(a));
+    } else if (filename == "exhibitors.txt" && store.loaded[CREDENTIALS]) {
+        for (const auto& e : store.exhibitors) lines.push_back(exhibitorLine(e));
+    } else if (filename == "admins.txt" && store.loaded[CREDENTIALS]) {
+        for (const auto& ad : store.admins) lines.push_back(adminLine(ad));
+    } else {
+        return false;
+    }
+    return true;
+}
 
-        if (!(cin >> index)) {
-            // Input is not an integer
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid index. Please enter a valid number.\n";
-            continue;
-        }
+void clearDirtyCollections() {
+    for (auto& d : store.dirty) d = false;
+}
 
-        cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Clear leftover newline
-        break;
+// Writes out only the collections that changed since the last checkpoint
+void flushStore() {
+    bool anyDirty = false;
+    for (bool d : store.dirty) anyDirty = anyDirty || d;
+    if (anyDirty || walPendingRecords > 0) {
+        checkpointStores();
+    } else {
+        writeSnapshots();
     }
+}
 
-    if (index == 0) { return; }
+Attendee findAttendee(string email) {
+    const CredentialEntry* entry = findCredential("Attendee", email);
+    Attendee foundAttendee;
+    if (entry && entry->profile != SIZE_MAX) {
+        foundAttendee = store.attendees[entry->profile];
+    }
+    return foundAttendee;
+}
 
-    for (auto& ann : announcements) {
-        if (ann.index == index && (ann.userType == filterType || ann.userType == "Both" || filterType == "Both")) {
-            cout << "\nEditing announcement " << index << ": " << ann.title << "\n";
-            cout << "Enter new user type (1. Attendee, 2. Exhibitor, 3. Both, leave blank to keep current): ";
-            string newUserType;
-            getline(cin, newUserType);
-            if (!newUserType.empty()) {
-                if (newUserType == "1") ann.userType = "Attendee";
-                else if (newUserType == "2") ann.userType = "Exhibitor";
-                else if (newUserType == "3") ann.userType = "Both";
-            }
-            
-            cout << "\nEnter new title (Maximum 20 Characters, leave blank to keep current): ";
-            string newTitle;
-            getline(cin, newTitle);
-            if (!newTitle.empty()) {
-                ann.title = newTitle;
-            }
-            cout << "\nEnter new content (Maximum 50 Characters, leave blank to keep current): ";
-            string newContent;
-            getline(cin, newContent);
-            if (!newContent.empty()) {
-                ann.content = newContent;
-            }
-            saveAnnouncements(announcements);
-            cout << "\n======================================\n";
-            cout << "||Announcement updated successfully! ||\n";
-            cout << "======================================\n";
-            
-            return;
-        }
+Exhibitor findExhibitor(string email) {
+    const CredentialEntry* entry = findCredential("Exhibitor", email);
+    Exhibitor foundExhibitor;
+    if (entry && entry->profile != SIZE_MAX) {
+        foundExhibitor = store.exhibitors[entry->profile];
     }
-    cout << "=====================================================\n";
-    cout << "|| Announcement not found, returning to dashboard. ||\n";
-    cout << "=====================================================\n";
+    return foundExhibitor;
 }
 
-void deleteAnnouncement(vector<Announcement>& announcements) {
-    
-    cout << "======================================\n";
-    cout << "||       Delete Announcement        ||\n";
-    cout << "======================================\n";
-    if (announcements.empty()) {
-        cout << "|| No announcements available.      ||\n";
-        cout << "======================================\n";
-        
-        return;
+Admin findAdmin(string email) {
+    const CredentialEntry* entry = findCredential("Admin", email);
+    Admin foundAdmin;
+    if (entry && entry->profile != SIZE_MAX) {
+        foundAdmin = store.admins[entry->profile];
     }
+    return foundAdmin;
+}
 
-    cout << "|| Select the usertype:             ||\n";
-    cout << "|| 1. Attendee                      ||\n";
-    cout << "|| 2. Exhibitor                     ||\n";
-    cout << "|| 3. Both                          ||\n";
-    cout << "|| 0. Back                          ||\n";
-    cout << "======================================\n";
-    cout << "Option ->";
-    int choice = getValidatedChoice(0, 3, "Choice: ");    
+// ==========================
+// SNAPSHOTS
+// ==========================
+// A binary copy of each collection as of the last checkpoint, so startup
+// reads one large block per collection instead of parsing every text line.
+// Each collection has its own file (expo.snap.tickets, ...), so a checkpoint
+// only rewrites the snapshots of the collections whose files it rewrote.
+// Layout (native byte order):
+//   header: magic "EXPS", version, collection, data file count (4 bytes
+//           each), then each data file's name and stamp
+//   dictionary: a count (4 bytes), then each distinct Symbol value the
+//           rows use, as a 4-byte length and the bytes
+//   tables: per data file a row count (8 bytes) and the rows; Symbol fields
+//           are a 4-byte dictionary index, other text fields a 4-byte
+//           length and the bytes
+// A snapshot is only used while its header matches the data files as they
+// are now; the log records written since are replayed on top of it.
+// Venues are left out, as venues.dat is already binary.
+const string SNAPSHOT_PREFIX = "expo.snap.";
+const uint32_t SNAPSHOT_VERSION = 2;
+
+template <typename T>
+void appendValue(string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
 
-    cout << endl;
+void appendText(string& out, const string& text) {
+    appendValue<uint32_t>(out, text.size());
+    out += text;
+}
 
-    if (choice == 0) { return; }
+// Rows are encoded apart from the dictionary, which is only complete once
+// every row has been seen
+struct SnapshotWriter {
+    string rows;
+    unordered_map<uint32_t, uint32_t> positions; // Symbol handle -> dictionary index
+    vector<Symbol> dictionary;
+};
 
-    string filterType;
-    if (choice == 1) filterType = "Attendee";
-    else if (choice == 2) filterType = "Exhibitor";
-    else filterType = "Both";
-
-    bool found = false;
-    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-    cout << "||               Current Announcements for " << left << setw(13) << filterType << "       ||\n";
-    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-    for (const auto& ann : announcements) {
-        if (ann.userType == filterType || ann.userType == "Both" || filterType == "Both") {
-            cout << "|| Index: " << left << setw(52) << ann.index << " ||\n";
-            cout << "|| User Type: " << left << setw(48) << ann.userType << " ||\n";
-            cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
-            cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
-            cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
-            found = true;
-        }
-    }
-    if (!found) {
-        cout << "======================================\n";
-        cout << "||     No announcements found       ||\n";
-        cout << "======================================\n";
-        
-        return;
-    }
+template <typename T>
+void appendValue(SnapshotWriter& out, T value) {
+    appendValue(out.rows, value);
+}
 
-    int index;
+void appendText(SnapshotWriter& out, const string& text) {
+    appendText(out.rows, text);
+}
 
-    while (true) {
-        cout << "\nEnter the index of the announcement to delete (or 0 to go back): ";
+void appendText(SnapshotWriter& out, Symbol text) {
+    auto entry = out.positions.emplace(text.id, out.dictionary.size());
+    if (entry.second) out.dictionary.push_back(text);
+    appendValue<uint32_t>(out.rows, entry.first->second);
+}
 
-        if (!(cin >> index)) {
-            // Input is not an integer
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            cout << "Invalid index. Please enter a valid number.\n";
-            continue;
-        }
+// The readers advance through in and return false once it runs short
+template <typename T>
+bool takeValue(string_view& in, T& value) {
+    if (in.size() < sizeof(T)) return false;
+    memcpy(&value, in.data(), sizeof(T));
+    in.remove_prefix(sizeof(T));
+    return true;
+}
 
-        cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Clear leftover newline
-        break;
-    }
+bool takeText(string_view& in, string& text) {
+    uint32_t len;
+    if (!takeValue(in, len) || in.size() < len) return false;
+    text.assign(in.data(), len);
+    in.remove_prefix(len);
+    return true;
+}
 
-    if (index == 0) { return; }
+// Each dictionary value is interned once, as it is read
+struct SnapshotReader {
+    string_view in;
+    vector<Symbol> dictionary;
+};
 
-    for (auto it = announcements.begin(); it != announcements.end(); ++it) {
-        if (it->index == index && (it->userType == filterType || it->userType == "Both" || filterType == "Both")) {
-            announcements.erase(it);
-            saveAnnouncements(announcements);
-            cout << "======================================\n";
-            cout << "||Announcement deleted successfully! ||\n";
-            cout << "======================================\n";
-            
-            return;
-        }
+bool takeDictionary(SnapshotReader& r) {
+    uint32_t count;
+    if (!takeValue(r.in, count) || count > r.in.size()) return false;
+    r.dictionary.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t len;
+        if (!takeValue(r.in, len) || r.in.size() < len) return false;
+        r.dictionary.push_back(Symbol(r.in.substr(0, len)));
+        r.in.remove_prefix(len);
     }
-    cout << "=====================================================\n";
-    cout << "|| Announcement not found, returning to dashboard. ||\n";
-    cout << "=====================================================\n";
-    
+    return true;
 }
 
-void adminAnnouncementSelection(vector<Announcement> &announcements) {
-    cout << "======================================\n";
-    cout << "||        Announcement Menu         ||\n";
-    cout << "======================================\n";
-    cout << "|| 1. Post Announcement             ||\n";
-    cout << "|| 2. Edit Announcement             ||\n";
-    cout << "|| 3. Delete Announcement           ||\n";
-    cout << "|| 4. View Announcement             ||\n";
-    cout << "|| 0. Back                          ||\n";
-    cout << "======================================\n";
-
-    int choice = getValidatedChoice(0, 4, "Choice: ");
+template <typename T>
+bool takeValue(SnapshotReader& r, T& value) {
+    return takeValue(r.in, value);
+}
 
-    switch (choice)
-    {
-        case 1: postAnnouncement(announcements); break;
-        case 2: editAnnouncement(announcements); break;
-        case 3: deleteAnnouncement(announcements); break;
-        case 4: viewAnnouncement(announcements, "Admin"); break;
-        case 0: return;
-    }
+bool takeText(SnapshotReader& r, string& text) {
+    return takeText(r.in, text);
 }
 
-// ==========================
-// FEEDBACK MODULE
-// ==========================
-void submitFeedback(const string& email, vector<Ticket> &tickets) {
-        // Only allow feedback for attended events
-        vector<string> attendedEvents;
-        for (const auto& t : tickets) {
-            if (t.userEmail == email) {
-                if (find(attendedEvents.begin(), attendedEvents.end(), t.eventName) == attendedEvents.end()) {
-                    attendedEvents.push_back(t.eventName);
-                }
-            }
-        }
-        
-        int eventChoice;
+bool takeText(SnapshotReader& r, Symbol& text) {
+    uint32_t index;
+    if (!takeValue(r.in, index) || index >= r.dictionary.size()) return false;
+    text = r.dictionary[index];
+    return true;
+}
 
-        if (attendedEvents.empty()) {
-            cout << "You have not attended any events yet. Cannot submit feedback.\n";
-            return;
+void encodeRow(SnapshotWriter& out, const Ticket& t) {
+    appendText(out, t.userEmail);
+    appendText(out, t.ticketID);
+    appendText(out, t.eventName);
+    appendText(out, t.ticketType);
+    appendValue(out, t.amount);
+}
 
-        } else {
-            cout << "Events you attended:\n";
-            for (size_t i = 0; i < attendedEvents.size(); ++i) {
-                cout << i + 1 << ". " << attendedEvents[i] << endl;
-            }
+bool decodeRow(SnapshotReader& in, Ticket& t) {
+    return takeText(in, t.userEmail) && takeText(in, t.ticketID) && takeText(in, t.eventName) &&
+           takeText(in, t.ticketType) && takeValue(in, t.amount);
+}
 
-            eventChoice = getValidatedChoice(0, attendedEvents.size(), "Select event to submit feedback for (0 to cancel): ");
+void encodeRow(SnapshotWriter& out, const Booth& b) {
+    appendText(out, b.userEmail);
+    appendText(out, b.venueID);
+    appendText(out, b.boothID);
+    appendValue(out, b.amount);
+    appendValue<uint8_t>(out, b.isRented);
+}
 
-            if (eventChoice == 0) {
-                cout << "Cancelled.\n";
-                return;
-            }
-        }
+bool decodeRow(SnapshotReader& in, Booth& b) {
+    uint8_t rented;
+    if (!(takeText(in, b.userEmail) && takeText(in, b.venueID) && takeText(in, b.boothID) &&
+          takeValue(in, b.amount) && takeValue(in, rented))) {
+        return false;
+    }
+    b.isRented = rented != 0;
+    return true;
+}
 
-    Feedback feedback;
-    feedback.email = email;
-    feedback.eventName = attendedEvents[eventChoice - 1];
+void encodeRow(SnapshotWriter& out, const Session& s) {
+    appendText(out, s.sessionID);
+    appendText(out, s.venueID);
+    appendText(out, s.exhibitorEmail);
+    appendText(out, s.topic);
+    appendText(out, s.timeSlot);
+}
 
-    while (true) {
-        cout << "Enter rating (1-5): ";
-        cin >> feedback.rating;
-        if (cin.fail() || feedback.rating < 1 || feedback.rating > 5) {
-            cout << "\n==============================================\n";
-            cout << "|| Invalid rating. Please enter 1 to 5 only ||\n";
-            cout << "==============================================\n\n";
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        } else {
-            break;
-        }
-    }
+bool decodeRow(SnapshotReader& in, Session& s) {
+    return takeText(in, s.sessionID) && takeText(in, s.venueID) && takeText(in, s.exhibitorEmail) &&
+           takeText(in, s.topic) && takeText(in, s.timeSlot);
+}
 
-    cin.ignore();
-    while(true) {
-        cout << "Enter your feedback: ";
-        getline(cin, feedback.comment);
-        if(feedback.comment == "") {
-            cout << "Feedback cannot be empty, please try again.\n\n";
-            continue;
-        }
+void encodeRow(SnapshotWriter& out, const Attendee& a) {
+    appendText(out, a.id);
+    appendText(out, a.name);
+    appendText(out, a.email);
+    appendText(out, a.password);
+}
 
-        break;
-    }
-    
-    cout << "Thank you for your feedback!\n";
-    saveFeedback(feedback);
+bool decodeRow(SnapshotReader& in, Attendee& a) {
+    return takeText(in, a.id) && takeText(in, a.name) && takeText(in, a.email) && takeText(in, a.password);
 }
 
-void viewFeedbacks() {
-    vector<Feedback> feedbacks = loadFeedbacks();
+void encodeRow(SnapshotWriter& out, const Exhibitor& e) {
+    appendText(out, e.id);
+    appendText(out, e.companyName);
+    appendText(out, e.email);
+    appendText(out, e.password);
+}
 
-    if (feedbacks.empty()) {
-        cout << "No feedback available." << endl;
-    } else {
-        cout << "\n===================================================\n";
-        cout << "||         Feedback Ratings and Comments         ||\n";
-        cout << "===================================================\n";
-        for (size_t i = 0; i < feedbacks.size(); ++i) {
-            cout << "\n================\n";
-            cout << "|| Feedback " << i + 1 << " ||\n";
-            cout << "================\n";
-            cout << "Email: " << feedbacks[i].email << endl;
-            cout << "Event: " << feedbacks[i].eventName << endl;
-            cout << "Rating: " << feedbacks[i].rating << endl;
-            cout << "Comment: " << feedbacks[i].comment << endl;
-        }
-    }
+bool decodeRow(SnapshotReader& in, Exhibitor& e) {
+    return takeText(in, e.id) && takeText(in, e.companyName) && takeText(in, e.email) && takeText(in, e.password);
+}
 
-    cout << "\nPress Enter to continue...";
-    cin.ignore();
+void encodeRow(SnapshotWriter& out, const Admin& ad) {
+    appendText(out, ad.email);
+    appendText(out, ad.password);
 }
 
-void deleteFeedback() {
-    vector<Feedback> feedbacks = loadFeedbacks();
+bool decodeRow(SnapshotReader& in, Admin& ad) {
+    return takeText(in, ad.email) && takeText(in, ad.password);
+}
 
-    if (feedbacks.empty()) {
-        cout << "No feedback to delete." << endl;
-        return;
-    }
+void encodeRow(SnapshotWriter& out, const Announcement& a) {
+    appendValue<int32_t>(out, a.index);
+    appendText(out, a.userType);
+    appendText(out, a.title);
+    appendText(out, a.content);
+}
 
-    // Display feedbacks
-    cout << "\n===================================================\n";
-    cout << "||         Feedback Ratings and Comments         ||\n";
-    cout << "===================================================\n";
-    for (size_t i = 0; i < feedbacks.size(); ++i) {
-        cout << "\n================\n";
-        cout << "|| Feedback " << i + 1 << " ||\n";
-        cout << "================\n";
-        cout << "Email: " << feedbacks[i].email << endl;
-        cout << "Event: " << feedbacks[i].eventName << endl;
-        cout << "Rating: " << feedbacks[i].rating << endl;
-        cout << "Comment: " << feedbacks[i].comment << endl;
+bool decodeRow(SnapshotReader& in, Announcement& a) {
+    int32_t index;
+    if (!(takeValue(in, index) && takeText(in, a.userType) && takeText(in, a.title) && takeText(in, a.content))) {
+        return false;
     }
+    a.index = index;
+    return true;
+}
 
-    // Ask user which to delete
-    int choice;
-    choice = getValidatedChoice(0, feedbacks.size(), "Enter which feedback you want to delete (0 to cancel): ");
+void encodeRow(SnapshotWriter& out, const Feedback& fb) {
+    appendText(out, fb.email);
+    appendText(out, fb.eventName);
+    appendValue<int32_t>(out, fb.rating);
+    appendText(out, fb.comment);
+}
 
-    if (choice == 0) {
-        cout << "Delete cancelled.\n";
-        return;
+bool decodeRow(SnapshotReader& in, Feedback& fb) {
+    int32_t rating;
+    if (!(takeText(in, fb.email) && takeText(in, fb.eventName) && takeValue(in, rating) && takeText(in, fb.comment))) {
+        return false;
     }
+    fb.rating = rating;
+    return true;
+}
 
-    // Remove selected feedback
-    feedbacks.erase(feedbacks.begin() + (choice - 1));
+template <typename Row>
+void encodeTable(SnapshotWriter& out, const vector<Row>& rows) {
+    appendValue<uint64_t>(out, rows.size());
+    for (const auto& row : rows) encodeRow(out, row);
+}
 
-    // Rewrite file
-    ofstream outFile("feedback.txt");
-    for (const auto& fb : feedbacks) {
-        outFile << fb.email << ","
-                << fb.eventName << ","
-                << fb.rating << ","
-                << fb.comment << endl;
-    }
-    outFile.close();
+// Decodes a data file's rows and replays its log records on top
+template <typename Row, typename Parse, typename Render, typename Lead>
+bool decodeTable(SnapshotReader& in, const string& filename, const vector<WalRecord>& tail, vector<Row>& rows,
+                 Parse parse, Render render, Lead lead) {
+    uint64_t count;
+    if (!takeValue(in, count) || count > in.in.size()) return false; // every row takes some bytes
+    rows.clear();
+    rows.resize(count);
+    for (auto& row : rows) {
+        if (!decodeRow(in, row)) return false;
+    }
+    size_t tombstones = replayLogRecords(rows, tail, filename, parse, render, lead);
+    noteStoreLoaded(filename, rows.size(), tombstones);
+    return true;
+}
 
-    cout << "====================================\n";
-    cout << "|| Feedback deleted successfully! ||\n";
-    cout << "====================================\n\n";
+string snapshotFile(Collection c) {
+    switch (c) {
+        case TICKETS: return SNAPSHOT_PREFIX + "tickets";
+        case BOOTHS: return SNAPSHOT_PREFIX + "booths";
+        case SESSIONS: return SNAPSHOT_PREFIX + "sessions";
+        case CREDENTIALS: return SNAPSHOT_PREFIX + "credentials";
+        case ANNOUNCEMENTS: return SNAPSHOT_PREFIX + "announcements";
+        case FEEDBACK: return SNAPSHOT_PREFIX + "feedback";
+        default: return "";
+    }
+}
 
+// The header a snapshot of the collection's files as they are now would have
+string snapshotHeader(Collection c) {
+    string header = "EXPS";
+    appendValue<uint32_t>(header, SNAPSHOT_VERSION);
+    appendValue<uint32_t>(header, c);
+    vector<string> files = collectionFiles(c);
+    appendValue<uint32_t>(header, files.size());
+    for (const auto& filename : files) {
+        FileStamp stamp = fileStamp(filename);
+        appendText(header, filename);
+        appendValue(header, stamp.size);
+        appendValue(header, stamp.modified);
+        appendValue(header, stamp.inode);
+    }
+    return header;
 }
 
-void adminFeedbackSelection() {
-    cout << "===========================================\n";
-    cout << "||             Feedback Menu             ||\n";
-    cout << "===========================================\n";
-    cout << "|| 1. View Feedbacks                     ||\n";
-    cout << "|| 2. Delete Inappropriate Feedback      ||\n";
-    cout << "|| 0. Back                               ||\n";
-    cout << "===========================================\n";
+// What loadCredentials reads from the same lines: each profile that has a password
+void rebuildCredentials() {
+    store.credentials.clear();
+    for (const auto& a : store.attendees) {
+        if (!a.password.empty()) store.credentials.push_back({a.email, a.password, "Attendee"});
+    }
+    for (const auto& e : store.exhibitors) {
+        if (!e.password.empty()) store.credentials.push_back({e.email, e.password, "Exhibitor"});
+    }
+    for (const auto& ad : store.admins) {
+        if (!ad.password.empty()) store.credentials.push_back({ad.email, ad.password, "Admin"});
+    }
+}
 
-    int choice = getValidatedChoice(0, 2, "Choice: ");
+// Fills a collection from its snapshot and the log records since. Returns
+// false when it has no current snapshot, and the text files are read instead.
+bool loadSnapshot(Collection c) {
+    string filename = snapshotFile(c);
+    if (filename.empty()) return false;
+    string header = snapshotHeader(c);
 
-    switch (choice)
+    // One read for the whole file
+    string bytes;
     {
-        case 1: viewFeedbacks(); break;
-        case 2: deleteFeedback(); break;
-        case 0: return;
+        STAT_TIMER(timer, "snapshot read");
+        ifstream file(filename, ios::binary | ios::ate);
+        if (!file.is_open()) return false;
+        streamoff size = file.tellg();
+        if (size < (streamoff)header.size()) return false;
+        bytes.resize(size);
+        file.seekg(0);
+        if (!file.read(&bytes[0], size)) return false;
+        timer.read(size);
+    }
+    if (bytes.compare(0, header.size(), header) != 0) return false;
+
+    STAT_TIMER(timer, "snapshot decode");
+    SnapshotReader in;
+    in.in = bytes;
+    in.in.remove_prefix(header.size());
+    if (!takeDictionary(in)) return false;
+    shared_ptr<const vector<WalRecord>> logged = loggedRecords();
+    const vector<WalRecord>& tail = *logged;
+    bool ok = false;
+    // Each table names the field its lines start with
+    switch (c) {
+        case TICKETS:
+            ok = decodeTable(in, "ticket.txt", tail, store.tickets, parseTicketLine, ticketLine,
+                             [](const Ticket& t) -> const string& { return t.userEmail; });
+            break;
+        case BOOTHS:
+            ok = decodeTable(in, "booth.txt", tail, store.booths, parseBoothLine, boothLine,
+                             [](const Booth& b) -> const string& { return b.userEmail; });
+            break;
+        case SESSIONS:
+            ok = decodeTable(in, "sessions.txt", tail, store.sessions, parseSessionLine, sessionLine,
+                             [](const Session& s) -> const string& { return s.sessionID; });
+            break;
+        case CREDENTIALS:
+            ok = decodeTable(in, "attendees.txt", tail, store.attendees, parseAttendeeLine, attendeeLine,
+                             [](const Attendee& a) -> const string& { return a.id; }) &&
+                 decodeTable(in, "exhibitors.txt", tail, store.exhibitors, parseExhibitorLine, exhibitorLine,
+                             [](const Exhibitor& e) -> const string& { return e.id; }) &&
+                 decodeTable(in, "admins.txt", tail, store.admins, parseAdminLine, adminLine,
+                             [](const Admin& ad) -> const string& { return ad.email; });
+            if (ok) rebuildCredentials();
+            break;
+        case ANNOUNCEMENTS:
+            ok = decodeTable(in, "announcements.txt", tail, store.announcements, parseAnnouncementLine, announcementLine,
+                             [](const Announcement& a) { return to_string(a.index); });
+            break;
+        case FEEDBACK:
+            ok = decodeTable(in, "feedback.txt", tail, store.feedbacks, parseFeedbackLine, feedbackLine,
+                             [](const Feedback& fb) -> const string& { return fb.email; });
+            break;
+        default: break;
     }
+    return ok && in.in.empty();
+}
 
+void writeSnapshot(Collection c, const string& header) {
+    STAT_TIMER(timer, "snapshot write");
+    SnapshotWriter tables;
+    switch (c) {
+        case TICKETS: encodeTable(tables, store.tickets); break;
+        case BOOTHS: encodeTable(tables, store.booths); break;
+        case SESSIONS: encodeTable(tables, store.sessions); break;
+        case CREDENTIALS:
+            encodeTable(tables, store.attendees);
+            encodeTable(tables, store.exhibitors);
+            encodeTable(tables, store.admins);
+            break;
+        case ANNOUNCEMENTS: encodeTable(tables, store.announcements); break;
+        case FEEDBACK: encodeTable(tables, store.feedbacks); break;
+        default: return;
+    }
+
+    string bytes = header;
+    appendValue<uint32_t>(bytes, tables.dictionary.size());
+    for (Symbol value : tables.dictionary) appendText(bytes, value.str());
+    bytes += tables.rows;
+
+    string filename = snapshotFile(c);
+    ofstream out(filename + ".tmp", ios::binary | ios::trunc);
+    out.write(bytes.data(), bytes.size());
+    out.close();
+    timer.wrote(bytes.size());
+    replaceFile(filename + ".tmp", filename);
 }
 
-// ==========================
-// TICKET MODULE
-// ==========================
-void purchaseTicket(vector<Venue>& venues, vector<Ticket>& tickets, const string& email) {
-    cout << "Available Events:\n";
-    for (size_t i = 0; i < venues.size(); ++i) {
-        if (!venues[i].isAvailable && !venues[i].eventName.empty())
-            cout << i+1 << ". " << venues[i].eventName << " (Venue " << venues[i].venueID << ")\n";
+// Writes a new snapshot of each loaded collection whose files changed since
+// its last one. Only valid with the log empty, when the resident copy of a
+// collection that is not stale is exactly its files.
+void writeSnapshots() {
+    StoreFileLock storeFiles;
+    error_code error;
+    if (filesystem::file_size(WAL_FILE, error) > 0 && !error) return;
+    for (Collection c : {TICKETS, BOOTHS, SESSIONS, CREDENTIALS, ANNOUNCEMENTS, FEEDBACK}) {
+        if (!store.loaded[c] || store.dirty[c] || collectionStale(c)) continue;
+        string header = snapshotHeader(c);
+        string current(header.size(), '\0');
+        ifstream file(snapshotFile(c), ios::binary);
+        if (file.read(&current[0], current.size()) && current == header) continue;
+        file.close();
+        writeSnapshot(c, header);
     }
+}
 
-    int choice = getValidatedChoice(0, venues.size(), "Select event (0 to cancel): ");
+// ==========================
+// LOGIN MODULE
+// ==========================
+bool checkCredentials(const string& role, const string& email, const string& password) {
+    const CredentialEntry* entry = findCredential(role, email);
+    return entry && entry->credential != SIZE_MAX && store.credentials[entry->credential].password == password;
+}
 
-    if(choice == 0) {
-        cout << "Purchasing ticket cancelled.\n";
-        return;
-    }
+string login(const string &role) {
+    const int maxAttempts = 3;
+    int attempts = 0;
 
-    Venue& v = venues[choice-1];
-    if(v.isAvailable) return;
-    cout << "Ticket Types:\n";
-    for (size_t i = 0; i < v.ticketType.size(); ++i) {
-        cout << i+1 << ". " << v.ticketType[i].type << " (RM" << v.ticketType[i].price << ", Remaining: " << (v.ticketType[i].capacity - v.ticketType[i].sold) << ")\n";
-    }
-
-    int ttype = getValidatedChoice(0, v.ticketType.size(), "Select ticket type (0 to cancel): ");
-    if(ttype == 0) {
-        cout << "Purchasing ticket cancelled.\n";
-        return;
-    }
-    
-    int qty = getValidatedChoice(1, (v.ticketType[ttype-1].capacity - v.ticketType[ttype-1].sold), "Quantity: ");
-    for (int i = 0; i < qty; ++i) {
-        Ticket t;
-        t.userEmail = email;
-        t.eventName = v.eventName;
-        t.ticketType = v.ticketType[ttype-1].type;
-        t.amount = v.ticketType[ttype-1].price;
-        t.ticketID = generateTicketID(tickets);
-        tickets.push_back(t);
-        saveTicket(t);
-    }
-
-    v.ticketType[ttype-1].sold += qty;
-    saveVenues(venues);
-    cout << "Tickets purchased successfully!\n";
-}
+    while (attempts < maxAttempts) {
+        cout << "============================================\n";
+        cout << "||     " << right << setw(13) << role << " Login Page           ||\n";
+        cout << "============================================\n";
+        LoginDetails user;
+        cout << "Enter email: ";
+        getline(cin, user.email);
+        cout << "Enter password: ";
+        getline(cin, user.password);
 
-void viewPurchasedTickets(const vector<Ticket>& tickets, const string& email) {
-    cout << "Your Tickets:\n";
-    bool found = false;
-    for (const auto& t : tickets) {
-        if (t.userEmail == email) {
-            cout << "Ticket ID: " << t.ticketID << ", Event: " << t.eventName << ", Type: " << t.ticketType << ", Amount: RM" << t.amount << endl;
-            found = true;
+        if (checkCredentials(role, user.email, user.password)) {
+            cout << "\n============================================\n";
+            cout << "||  Login successful! Welcome, " << left << setw(10) << role << " ||\n";
+            cout << "============================================\n";
+            return user.email;
         }
+        cout << "\nInvalid credentials. Attempts left: " << maxAttempts - attempts - 1 << "\n";
+        attempts++;
     }
-    if (!found) cout << "No tickets found.\n";
-    cout << "Press Enter to continue...";
-    cin.ignore();
+    cout << "===============================================\n";
+    cout << "||" << right << setw(10) << role << " login failed after 3 attempts   ||\n";
+    cout << "===============================================\n";
+    return "";
 }
 
-void refundTicket(const string& email) {
-    vector<Ticket> tickets;
-    loadTickets(tickets);
+// ==========================
+// SIGN UP MODULE
+// ==========================
+void signUp(vector<UserCredential> &credentials) {
 
-    // Show user's tickets
-    vector<Ticket> userTickets;
-    for (const auto& t : tickets) {
-        if (t.userEmail == email) userTickets.push_back(t);
-    }
-    if (userTickets.empty()) {
-        cout << "You have no tickets to refund.\n";
-        return;
-    }
-    cout << "Your tickets:\n";
-    for (size_t i = 0; i < userTickets.size(); ++i) {
-        cout << i+1 << ". Ticket ID: " << userTickets[i].ticketID
-             << ", Event: " << userTickets[i].eventName
-             << ", Type: " << userTickets[i].ticketType
-             << ", Amount: RM" << fixed << setprecision(2) << userTickets[i].amount << endl;
-    }
-    
-    int choice = getValidatedChoice(0, (int)userTickets.size(), "Enter which ticket you to refund (0 to cancel): ");
-    if (choice == 0) {
-        cout << "Refund cancelled.\n";
-        return;
-    }
+    const string adminVerificationPassword = "secureAdmin123";
+    int choice;
+
+    while (true)
+    {
+        cout << "=======================================================\n";
+        cout << "||                    Sign Up Menu                   ||\n";
+        cout << "=======================================================\n";
+        cout << "|| Register as:                                      ||\n";
+        cout << "|| 1. Attendee                                       ||\n";
+        cout << "|| 2. Exhibitor                                      ||\n";
+        cout << "|| 3. Admin                                          ||\n";
+        cout << "|| 0. Return to Main Menu                            ||\n";
+        cout << "=======================================================\n";
+        cout << "Choice: ";
 
-    string ticketID = userTickets[choice-1].ticketID;
-    string eventName = userTickets[choice-1].eventName;
-    string ticketType = userTickets[choice-1].ticketType;
-    double amount = userTickets[choice-1].amount;
+        cin >> choice;
+        cout << endl;
 
-    // Remove ticket from tickets vector
-    vector<Ticket> updatedTickets;
-    bool found = false;
-    for (const auto& t : tickets) {
-        if (t.ticketID == ticketID && t.userEmail == email) {
-            found = true;
-            // Write refund log
-            ofstream refundFile("Ticketrefunds.txt", ios::app);
-            refundFile << t.userEmail << "," << t.ticketID << "," << t.eventName << "," << t.ticketType << "," << t.amount << ",REFUNDED\n";
-            refundFile.close();
-            cout << "Refund amount: RM" << fixed << setprecision(2) << t.amount << endl;
+        if (cin.fail() || choice < 0 || choice > 3) {
+            cin.clear();
+            clearInputBuffer();
+            cout << "=======================================================\n";
+            cout << "||         Invalid Choice, please try again!          ||\n";
+            cout << "=======================================================\n";
         } else {
-            updatedTickets.push_back(t);
+            break;
         }
+        
     }
-    if (!found) {
-        cout << "Ticket not found or not owned by user.\n";
-        return;
-    }
-    // Save updated tickets
-    ofstream outFile("ticket.txt");
-    for (const auto& t : updatedTickets) {
-        outFile << t.userEmail << "," << t.ticketID << "," << t.eventName << "," << t.ticketType << "," << t.amount << endl;
-    }
-    outFile.close();
+    clearInputBuffer();
 
-    // Update venue ticketType sold count
-    vector<Venue> venues;
-    loadVenues(venues);
-    for (auto& v : venues) {
-        if (v.eventName == eventName) {
-            for (auto& tt : v.ticketType) {
-                if (tt.type == ticketType && tt.sold > 0) {
-                    tt.sold -= 1;
-                }
-            }
-            break;
+    // Verify if user has the permission to create an admin account
+    if(choice == 3) {
+        cout << "Enter admin verification password: ";
+        string verificationPassword;
+        getline(cin, verificationPassword);
+        if (verificationPassword != adminVerificationPassword) {
+            cout << "======================================\n";
+            cout << "|| Incorrect admin password.        ||\n";
+            cout << "|| Admin account creation denied.   ||\n";
+            cout << "======================================\n";
+
+            return;
         }
+
     }
-    saveVenues(venues);
-}
 
-void attendeeTicketSelection(const string& email) {
-    cout << "===========================================\n";
-    cout << "||             Ticket Menu               ||\n";
-    cout << "===========================================\n";
-    cout << "|| 1. View Purchased Tickets             ||\n";
-    cout << "|| 2. Refund Ticket                      ||\n";
-    cout << "|| 0. Back                               ||\n";
-    cout << "===========================================\n";
+    if(choice == 1) {
+        // Attendee signup
+        Attendee a;
 
-    int choice = getValidatedChoice(0, 2, "Choice: ");
+        // id field (auto generated)
+        a.id = allocateId('A');
+        cout << "Generated Attendee ID: " << a.id << endl;
 
-    vector<Ticket> tickets; loadTickets(tickets);
+        // name field
+        do {
+            cout << "Enter Name: "; getline(cin, a.name);
 
-    switch (choice)
-    {
-        case 1: viewPurchasedTickets(tickets, email); break;
-        case 2: refundTicket(email); break;
-        case 0: return;
-    }
-}
+            if(a.name.empty()) {
+                cout << "\n==================================================\n";
+                cout << "||    Name cannot be empty. Please try again    ||\n";
+                cout << "==================================================\n\n";
+            }
+        } while (a.name.empty());
 
-// ==========================
-// BOOTH MODULE
-// ==========================
-void displayBoothLayout(const Venue& venue) {
-    cout << "Booth layout for " << venue.eventName << ": " << endl;
-    vector<Booth> booths;
-    loadBooths(booths);
-    cout << "    ";
-    for (int j =  0; j < venue.columns; j++) {
-        char colLetter = 'A' + j;
-        cout << colLetter << "    ";
-    }
-    cout << endl;
-    for (int i = 0; i < venue.rows; i++) {
-        cout << i+1 << "  ";
-        for (int j = 0; j < venue.columns; j++) {
-            char colLetter = 'A' + j;
-            string boothID = string(1, colLetter) + to_string(i + 1);
-            bool booked = false;
-            for (const auto& b : booths) {
-                if (b.boothID == boothID && b.venueID == venue.venueID && b.isRented) {
-                    booked = true;
-                    break;
+
+        // email field
+        while(true) {
+            bool emailExists = false;
+            cout << "Enter Email: "; getline(cin, a.email);
+            if (!isValidEmail(a.email)) {
+                cout << "\n==============================================\n";
+                cout << "||  Invalid email format. Please try again  ||\n";
+                cout << "==============================================\n\n";
+
+            } else {
+                if (emailRegistered(a.email)) {
+                    cout << "\n=======================================================\n";
+                    cout << "|| Email already exists. Please use a different email. ||\n";
+                    cout << "=========================================================\n\n";
+                    emailExists = true;
                 }
+
+                if(!emailExists) { break; }
             }
-            cout << (booked ? "[x]" : "[ ]");
-            if (j < venue.columns - 1) cout << "  ";
         }
-        cout << endl;
-    }
-}
 
-void bookBooth(vector<Venue>& venues, vector<Booth>& booths, const string& email) {
-    cout << "Available Venues:\n";
-    for (size_t i = 0; i < venues.size(); ++i) {
-        if (!venues[i].isAvailable && !venues[i].eventName.empty())
-            cout << i+1 << ". " << venues[i].eventName << " (Venue " << venues[i].venueID << ")\n";
-    }
-    int choice = getValidatedChoice(0, venues.size(), "Select venue (0 to cancel): ");
-    if (choice == 0) return;
+        // password field
+        do {
+            cout << "Enter Password: "; getline(cin, a.password);
+
+            if(a.password.empty()) {
+                cout << "\n==================================================\n";
+                cout << "||  Password cannot be empty. Please try again  ||\n";
+                cout << "==================================================\n\n";
+            }
+        } while (a.password.empty());
+        
+        // save to vector
+        credentials.push_back({a.email, a.password, "Attendee"});
+        store.attendees.push_back(a);
+        indexNewAccount("Attendee", a.email, store.attendees.size() - 1);
+        markDirty(CREDENTIALS);
+
+        // save to attendees.txt
+        walAppend("attendees.txt", attendeeLine(a));
+        cout << "\nAttendee account created successfully!\n";
     
-    Venue& v = venues[choice-1];
+    } else if(choice == 2) {
+        // Exhibitor signup
+        Exhibitor e;
 
-    if(v.isAvailable) return;
+        // id field (auto generated)
+        e.id = allocateId('E');
+        cout << "Generated Exhibitor ID: " << e.id << endl;
 
-    displayBoothLayout(v);
+        // company name field
+        do {
+            cout << "Enter Company Name: "; getline(cin, e.companyName);
 
-    string boothID; 
-    while(true) {
-        bool sameBooth = false;
-        cout << "Enter booth ID to rent (e.g. A1, B2): ";
-        getline(cin, boothID);
+            if(e.companyName.empty()) {
+                cout << "\n====================================================\n";
+                cout << "|| Company name cannot be empty. Please try again ||\n";
+                cout << "====================================================\n\n";
+            }
+        } while (e.companyName.empty());
         
-        boothID[0] = toupper(boothID[0]);
+        // email field
+        while(true) {
+            bool emailExists = false;
+            cout << "Enter Email: "; getline(cin, e.email);
+            if (!isValidEmail(e.email)) {
+                cout << "\n==============================================\n";
+                cout << "||  Invalid email format. Please try again  ||\n";
+                cout << "==============================================\n\n";
 
-        if (!isValidBoothID(v, boothID)) {
-            cout << "Invalid booth ID.\n\n";
-            continue;
-        }
-        for (const auto& booked : booths) {
-            if (booked.venueID == v.venueID && booked.boothID == boothID && booked.isRented) {
-                cout << "Booth already booked.\n\n";
-                sameBooth = true;
+            } else {
+                if (emailRegistered(e.email)) {
+                    cout << "\n=======================================================\n";
+                    cout << "|| Email already exists. Please use a different email. ||\n";
+                    cout << "=========================================================\n\n";
+                    emailExists = true;
+                }
+
+                if(!emailExists) { break; }
             }
         }
+            
+        // password field
+        do {
+            cout << "Enter Password: "; getline(cin, e.password);
 
-        if (!sameBooth)
-        {
-            break;
-        }        
-    }
-
-    double price = 0.0;
-    for (const auto& b : v.boothType) {
-        if (b.boothID == boothID) price = b.price;
-    }
-    cout << "Booth price: RM" << fixed << setprecision(2) << price << endl;
-    
-    char confirm;
-    while(true) {
-        cout << "Confirm rental of booth " << boothID << "? (y/n): ";
-        cin >> confirm;
-        cin.ignore();
-
-        if(confirm == 'Y' || confirm == 'N' || confirm == 'y' || confirm == 'n') break;
-
-        cout << "Invalid input. Please try again.\n\n";
-    }
+            if(e.password.empty()) {
+            cout << "\n==================================================\n";
+            cout << "||  Password cannot be empty. Please try again  ||\n";
+            cout << "==================================================\n\n";
+            }
+        } while (e.password.empty());
+        
+        // save to vector
+        credentials.push_back({e.email, e.password, "Exhibitor"});
+        store.exhibitors.push_back(e);
+        indexNewAccount("Exhibitor", e.email, store.exhibitors.size() - 1);
+        markDirty(CREDENTIALS);
 
-    if(confirm == 'N' || confirm == 'n') {
-        cout << "Booth rental cancelled.\n";
-        return;
-    }
+        // save to exhibitors.txt
+        walAppend("exhibitors.txt", exhibitorLine(e));
+        cout << "\nExhibitor account created successfully!\n";
 
-    Booth b;
-    b.userEmail = email;
-    b.venueID = v.venueID;
-    b.boothID = boothID;
-    b.amount = price;
-    b.isRented = true;
-    booths.push_back(b);
-    saveBooth(b);
+    } else if(choice == 3) {
+        // Admin signup
+        Admin admin;
 
-    cout << "Booth booked successfully!\n";
-}
+        // email field
+        while(true) {
+            bool emailExists = false;
+            cout << "Enter Email: "; getline(cin, admin.email);
+            if (!isValidEmail(admin.email)) {
+                cout << "\n==============================================\n";
+                cout << "||  Invalid email format. Please try again  ||\n";
+                cout << "==============================================\n\n";
 
-void viewBooth(const string& email){
-    vector<Booth> booths;
-    bool found = false;
-    loadBooths(booths);
-    for (const auto& booth : booths) {
-        if (booth.userEmail == email && booth.isRented) {
-            found = true;
-            cout << endl;
-            cout << "Booth ID: " << booth.boothID << endl;
-            cout << "Venue ID: " << booth.venueID << endl;
-            cout << "Amount: $" << fixed << setprecision(2) << booth.amount << endl;
-            cout << "--------------------------" << endl;
+            } else {
+                if (emailRegistered(admin.email)) {
+                    cout << "\n=======================================================\n";
+                    cout << "|| Email already exists. Please use a different email. ||\n";
+                    cout << "=========================================================\n\n";
+                    emailExists = true;
+                }
+                if(!emailExists) { break; }
+            }
         }
-    }
-    if (!found) {
-        cout << "No booths found for this email." << endl;
-    }
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+        // password field
+        do {
+            cout << "Enter Password: "; getline(cin, admin.password);
 
-}
+            if(admin.password.empty()) {
+            cout << "\n==================================================\n";
+            cout << "||  Password cannot be empty. Please try again  ||\n";
+            cout << "==================================================\n\n";
+            }
+        } while (admin.password.empty());
 
-void viewAllBookedBooths(const string &venueID) {
-    vector<Booth> booths;
-    loadBooths(booths);
+        // save to vector
+        credentials.push_back({admin.email, admin.password, "Admin"});
+        store.admins.push_back(admin);
+        indexNewAccount("Admin", admin.email, store.admins.size() - 1);
+        markDirty(CREDENTIALS);
+
+        // save to admins.txt
+        walAppend("admins.txt", adminLine(admin));
+        cout << "\nAdmin account created successfully!\n";
 
-    for (const auto& b : booths) {
-        if (b.isRented && b.venueID == venueID) {
-            cout << "Booth ID: " << b.boothID << ", User Email: " << b.userEmail << endl;
-        }
     }
 }
 
-void refundBooth(const string& email) {
-    vector<Booth> booths;
-    loadBooths(booths);
-
-    // Show user's booths
-    vector<Booth> userBooths;
-    for (const auto& b : booths) {
-        if (b.userEmail == email && b.isRented) userBooths.push_back(b);
-    }
-    if (userBooths.empty()) {
-        cout << "You have no booths to refund.\n";
-        return;
-    }
-    cout << "Your rented booths:\n";
-    for (size_t i = 0; i < userBooths.size(); ++i) {
-        cout << i+1 << ". Booth ID: " << userBooths[i].boothID
-             << ", Venue ID: " << userBooths[i].venueID
-             << ", Amount: RM" << fixed << setprecision(2) << userBooths[i].amount << endl;
-    }
+// ==========================
+// USER PROFILES
+// ==========================
+void viewAttendeeProfile(Attendee &a) {
+    cout << "\n============================================================\n";
+    cout << "||                   ATTENDEE PROFILE                     ||\n";
+    cout << "============================================================\n";
+    cout << "|| ID        : " << left << setw(43) << a.id << "||\n";
+    cout << "|| Name      : " << left << setw(43) << a.name << "||\n";
+    cout << "|| Email     : " << left << setw(43) << a.email << "||\n";
+    cout << "|| Password  : " << left << setw(43) << a.password << "||\n";
+    cout << "============================================================\n\n";
+}
 
-    int choice = getValidatedChoice(0, (int)userBooths.size(), "Enter which booth you want to refund (0 to cancel): ");
-    if (choice == 0) {
-        cout << "Refund cancelled.\n";
-        return;
-    }
+void updateAttendeeProfile(Attendee &a, vector<UserCredential> &credentials) {
+    viewAttendeeProfile(a);
 
-    string boothID = userBooths[choice-1].boothID;
-    string venueID = userBooths[choice-1].venueID;
-    double amount = userBooths[choice-1].amount;
+    cout << "===================================\n";
+    cout << "||  Updating Attendee's Profile  ||\n";
+    cout << "===================================\n\n";
 
-    // Remove booth from booths vector (set isRented to false)
-    vector<Booth> updatedBooths;
-    bool found = false;
-    for (auto& b : booths) {
-        if (b.boothID == boothID && b.userEmail == email && b.venueID == venueID && b.isRented) {
-            found = true;
-            // Write refund log
-            ofstream refundFile("boothRefunds.txt", ios::app);
-            refundFile << b.userEmail << "," << b.boothID << "," << b.venueID << "," << b.amount << ",REFUNDED\n";
-            refundFile.close();
-            cout << "Refund amount: RM" << fixed << setprecision(2) << b.amount << endl;
-            b.isRented = false; // Mark as not rented
+    const CredentialEntry* entry = findCredential("Attendee", a.email);
+    if (entry && entry->profile != SIZE_MAX) {
+        Attendee& attendee = store.attendees[entry->profile];
+        string oldLine = attendeeLine(attendee);
+        cout << "Enter new name (leave blank to keep current): ";
+        string newName; getline(cin, newName);
+        if(!newName.empty()) {
+            a.name = newName;
+            attendee.name = newName;
         }
-        updatedBooths.push_back(b);
-    }
-    if (!found) {
-        cout << "Booth not found or not owned by user.\n";
-        return;
-    }
-    // Save updated booths
-    ofstream outFile("booth.txt");
-    for (const auto& b : updatedBooths) {
-        outFile << b.userEmail << "," << b.venueID << "," << b.boothID << "," << (b.isRented ? "1" : "0") << "," << b.amount << endl;
-    }
-    outFile.close();
 
-    // Update venue boothType isRented status
-    vector<Venue> venues;
-    loadVenues(venues);
-    for (auto& v : venues) {
-        if (v.venueID == venueID) {
-            for (auto& bt : v.boothType) {
-                if (bt.boothID == boothID) {
-                    bt.isRented = false;
-                }
-            }
-            break;
+        cout << "Enter new password (leave blank to keep current): ";
+        string newPass; getline(cin, newPass);
+        if(!newPass.empty()) {
+            a.password = newPass;
+            attendee.password = newPass;
         }
+
+        // Log the changed line only
+        walReplace("attendees.txt", oldLine, attendeeLine(attendee));
+        markDirty(CREDENTIALS);
     }
-    saveVenues(venues);
-}
 
-void exhibitorBoothSelection(const string& email) {
-    cout << "===========================================\n";
-    cout << "||              Booth Menu               ||\n";
-    cout << "===========================================\n";
-    cout << "|| 1. View Booked Booths                 ||\n";
-    cout << "|| 2. Refund Booth                       ||\n";
-    cout << "|| 0. Back                               ||\n";
-    cout << "===========================================\n";
+    // Update vector
+    if (entry && entry->credential != SIZE_MAX) {
+        credentials[entry->credential].password = a.password;
+    }
 
-    int choice = getValidatedChoice(0, 2, "Choice: ");
 
-    switch (choice)
-    {
-        case 1: viewBooth(email); break;
-        case 2: refundBooth(email); break;
-        case 0: return;
-    }
+    cout << "\n=======================================\n";
+    cout << "|| Profile updated successfully!     ||\n";
+    cout << "=======================================\n";
 }
 
-// ==========================
-// VENUE MODULE
-// ==========================
-void makeNewVenueBooking(Venue& venue) {
-    cin.clear();
-    cout << "Please enter the details for the new venue booking. (0 to cancel)" << endl;
-    string eventName;
+void deleteAttendeeProfile(Attendee &a) {
+    cout << "\n==============================================================\n";
+    cout << "|| WARNING, ONCE ACCOUNT IS DELETED, ALL DATA WILL BE LOST. ||\n";
+    cout << "==============================================================\n";
 
-    do{
-        cout << "\nEnter the name for the event: ";
-        getline(cin, eventName);
-        if (eventName == "0") {
-            cout << "Booking cancelled.\n" << endl;
+    string confirmation; 
+    while (true) {
+        cout << "\nAre you sure you want to delete your account? (Y/N): ";
+        getline(cin, confirmation);
+
+        if(confirmation == "N" || confirmation == "n") {
+            cout << "Returning to dashboard.\n";
             return;
+        } else if (confirmation == "Y" || confirmation == "y") {
+            break;
+        } else {
+            cout << "Invalid input. Please try again.\n";
         }
+    }
 
-        if(eventName.empty()) {
-            cout << "Event name cannot be empty, please try again.\n";
-        }
-    } while(eventName.empty());
+    // Drop the account from memory, then log a delete for its line
+    const CredentialEntry* entry = findCredential("Attendee", a.email);
+    if (!entry) return;
+    string line = (entry->profile != SIZE_MAX) ? attendeeLine(store.attendees[entry->profile]) : "";
+    removeAccount(store.attendees, "Attendee", a.email);
+    markDirty(CREDENTIALS);
+    if (!line.empty()) walRemove("attendees.txt", line);
 
-    venue.eventName = eventName;
+}
 
+void viewExhibitorProfile(Exhibitor &e) {
+    cout << "\n============================================================\n";
+    cout << "||                  EXHIBITOR PROFILE                     ||\n";
+    cout << "============================================================\n";
+    cout << "|| ID          : " << left << setw(41) << e.id << "||\n";
+    cout << "|| Company     : " << left << setw(41) << e.companyName << "||\n";
+    cout << "|| Email       : " << left << setw(41) << e.email << "||\n";
+    cout << "|| Password    : " << left << setw(41) << e.password << "||\n";
+    cout << "============================================================\n\n";
+}
 
-    cout << "\nEnter the number of rows and columns of booths to be added (Maximum 10 rows and 10 columns).\n";
-    int rows = getValidatedChoice(0, 10, "Rows: ");
-    if (rows == 0 ) {
-        cout << "Booking cancelled." << endl;
-        return;
-    }
-    venue.rows = rows;
+void updateExhibitorProfile(Exhibitor &e, vector<UserCredential> &credentials) {
+    viewExhibitorProfile(e);
 
-    int cols = getValidatedChoice(0, 10, "Columns: ");
-    if (cols == 0) {
-        cout << "Booking cancelled." << endl;
-        return;
-    }
-    venue.columns = cols;
+    cout << "====================================\n";
+    cout << "||  Updating Exhibitor's Profile  ||\n";
+    cout << "====================================\n\n";
 
-    double boothPrice;
-    while(true) {
-        cout << "\nEnter booth price (fixed for the event): RM ";
+    const CredentialEntry* entry = findCredential("Exhibitor", e.email);
+    if (entry && entry->profile != SIZE_MAX) {
+        Exhibitor& exhibitor = store.exhibitors[entry->profile];
+        string oldLine = exhibitorLine(exhibitor);
+        cout << "Enter new company name (leave blank to keep current): ";
+        string newName; getline(cin, newName);
+        if(!newName.empty()) {
+            e.companyName = newName;
+            exhibitor.companyName= newName;
+        }
 
-        if(!(cin >> boothPrice)) {
-            cout << "Invalid booth price, please enter a valid number.\n";
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            continue;
+        cout << "Enter new password (leave blank to keep current): ";
+        string newPass; getline(cin, newPass);
+        if(!newPass.empty()) {
+            e.password = newPass;
+            exhibitor.password = newPass;
         }
 
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        break;
+        // Log the changed line only
+        walReplace("exhibitors.txt", oldLine, exhibitorLine(exhibitor));
+        markDirty(CREDENTIALS);
     }
 
-    if (boothPrice <= 0) {
-        cout << "Booking cancelled." << endl;
-        return;
+    // Update vector
+    if (entry && entry->credential != SIZE_MAX) {
+        credentials[entry->credential].password = e.password;
     }
 
-    venue.boothType.clear();
-    for (int i = 0; i < venue.rows; i++) {
-        for (int j = 0; j < venue.columns; j++) {
-            BoothType bt;
-            bt.boothID = string(1, 'A' + j) + to_string(i + 1);
-            bt.price = boothPrice;
-            bt.isRented = false; 
-            venue.boothType.push_back(bt);
-        }
-    }
 
-    int ticketTypes;
-    while(true) {
-        cout << "\nEnter the number of ticket types: ";
+    cout << "\n=======================================\n";
+    cout << "|| Profile updated successfully!     ||\n";
+    cout << "=======================================\n";
+}
 
-        if(!(cin >> ticketTypes)) {
-            cout << "Invalid ticket type, please enter a valid number.\n\n";
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            continue;
-        }
-       
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        break;
-    }
+void deleteExhibitorProfile(Exhibitor &e) {
+    cout << "\n==============================================================\n";
+    cout << "|| WARNING, ONCE ACCOUNT IS DELETED, ALL DATA WILL BE LOST. ||\n";
+    cout << "==============================================================\n";
 
-    if (ticketTypes <= 0) {
-        cout << "Booking cancelled." << endl;
-        return;
-    }
-    
-    venue.ticketType.clear();
-    for (int i = 0; i < ticketTypes; ++i) {
-        TicketType t;
-        cout << "\nEnter details for ticket type " << i + 1 << ":" << endl;
+    string confirmation; 
+    while (true) {
+        cout << "\nAre you sure you want to delete your account? (Y/N): ";
+        getline(cin, confirmation);
 
-        cout << "Type: ";
-        getline(cin, t.type); 
+        if(confirmation == "N" || confirmation == "n") {
+            cout << "Returning to dashboard.\n";
+            return;
+        } else if (confirmation == "Y" || confirmation == "y") {
+            break;
+        } else {
+            cout << "Invalid input. Please try again.\n";
+        }
+    }
 
-        cout << "Price: RM";
-        cin >> t.price;
-        cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
+    // Drop the account from memory, then log a delete for its line
+    const CredentialEntry* entry = findCredential("Exhibitor", e.email);
+    if (!entry) return;
+    string line = (entry->profile != SIZE_MAX) ? exhibitorLine(store.exhibitors[entry->profile]) : "";
+    removeAccount(store.exhibitors, "Exhibitor", e.email);
+    markDirty(CREDENTIALS);
+    if (!line.empty()) walRemove("exhibitors.txt", line);
 
-        cout << "Capacity: ";
-        cin >> t.capacity;
-        cin.ignore(numeric_limits<streamsize>::max(), '\n'); 
+}
 
-        t.sold = 0;
-        venue.ticketType.push_back(t);
-    }
-    if (venue.ticketType.empty()) {
-        cout << "No ticket types added. Booking cancelled." << endl;
-        return;
-    }
-    venue.isAvailable = false;
-    cout << "New event created successfully." << endl;
+void viewAdminProfile(Admin &ad) {
+    cout << "\n============================================================\n";
+    cout << "||                     ADMIN PROFILE                      ||\n";
+    cout << "============================================================\n";
+    cout << "|| Email     : " << left << setw(43) << ad.email << "||\n";
+    cout << "|| Password  : " << left << setw(43) << ad.password << "||\n";
+    cout << "============================================================\n\n";
 }
 
-void viewVenueAvailability(vector<Venue>& venues) {
-    cout << "Venues: " << endl;
-    for (size_t i = 0; i < venues.size(); i++) {
-        if (venues[i].isAvailable) {
-            cout << i + 1 << ". Venue " << venues[i].venueID << endl;
-        }
-    }
+void updateAdminProfile(Admin &ad, vector<UserCredential> &credentials) {
+    viewAdminProfile(ad);
 
-    int choice;
-    while(true) {
-        cout << "Enter the venue no. of your choice (enter 0 to cancel): ";
-        if(!(cin >> choice) || choice < 0 || choice > venues.size() || !venues[choice - 1].isAvailable) {
-            cout << "Invalid or already booked venue." << endl;
-            cin.clear();
-            cin.ignore(numeric_limits<streamsize>::max(), '\n');
-            continue;
-        }
+    cout << "================================\n";
+    cout << "||  Updating Admin's Profile  ||\n";
+    cout << "================================\n\n";
 
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
-        break;
+    const CredentialEntry* entry = findCredential("Admin", ad.email);
+    if (entry && entry->profile != SIZE_MAX) {
+        Admin& admin = store.admins[entry->profile];
+        string oldLine = adminLine(admin);
+        cout << "Enter new password (leave blank to keep current): ";
+        string newPass; getline(cin, newPass);
+        if(!newPass.empty()) {
+            ad.password = newPass;
+            admin.password = newPass;
+        }
 
+        // Log the changed line only
+        walReplace("admins.txt", oldLine, adminLine(admin));
+        markDirty(CREDENTIALS);
     }
 
-    if (choice == 0) {
-        cout << "Booking cancelled." << endl;
-        cin.ignore();
-        return;
+    // Update vector
+    if (entry && entry->credential != SIZE_MAX) {
+        credentials[entry->credential].password = ad.password;
     }
 
-    makeNewVenueBooking(venues[choice - 1]);
-    saveVenues(venues);
-    cout << "Venue " << venues[choice - 1].venueID << " booked successfully." << endl;
+
+    cout << "\n=======================================\n";
+    cout << "|| Profile updated successfully!     ||\n";
+    cout << "=======================================\n";
 }
 
-void viewAllVenue(const vector<Venue>& venues) {
-    bool hasVenue = false;
-    for (const auto& v : venues) {
-        if (!v.eventName.empty()) {
-            hasVenue = true;
-            break;
-        }
-    }
-    if (!hasVenue) {
-        cout << "No venues have been created yet." << endl;
-        return;
-    }
-    for (const auto& v : venues) {
-        if (!v.venueID.empty() && !v.isAvailable) {
-            cout << "Venue ID: " << v.venueID << endl;
-            cout << "Event Name: " << v.eventName << endl;
-            displayBoothLayout(v);
-            cout << endl;
-            viewAllBookedBooths(v.venueID);
-            cin.ignore();
-        }
-    }
+// ==========================
+// MARKETING MODULE (ANNOUNCEMENT)
+// ==========================
+void postAnnouncement(vector<Announcement>& announcements) {
+    Announcement a;
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+    cout << "======================================\n";
+    cout << "||        Post Announcement         ||\n";
+    cout << "======================================\n";
+    cout << "|| Select the recipient user type:  ||\n";
+    cout << "|| 1. Attendee                      ||\n";
+    cout << "|| 2. Exhibitor                     ||\n";
+    cout << "|| 3. Both                          ||\n";
+    cout << "|| 0. Back                          ||\n";
+    cout << "======================================\n";
+    
+    int choice = getValidatedChoice(0, 3, "Choice: "); 
 
-}
+    if(choice == 0) return;
+    else if (choice == 1) a.userType = "Attendee";
+    else if (choice == 2) a.userType = "Exhibitor";
+    else a.userType = "Both";
 
-void closeEvent(const string& venueID, vector<Venue>& venues) {
-    // Find the event name for the given venue ID
-    string targetEventName = "";
-    for (const auto& v : venues) {
-        if (v.venueID == venueID) {
-            targetEventName = v.eventName;
-            break;
+    while(true)
+    {
+        cout << "Enter title (Maximum 20 Characters): ";
+        getline(cin, a.title);
+
+        if(a.title == "") {
+            cout << "Title cannot be empty. Please try again.\n\n";
+        } else {
+            if(a.title.length() <= 20) {
+                break;
+            } else {
+                cout << "Title has more than 20 characters. Please try again.\n\n";
+            }
         }
-    }
 
-    if (targetEventName.empty()) {
-        cout << "Event not found." << endl;
-        return;
     }
 
-    // Remove all tickets for this event
-    vector<Ticket> tickets;
-    loadTickets(tickets);
-    ofstream ticketFile("ticket.txt");
-    for (const auto& t : tickets) {
-        if (t.eventName != targetEventName) { // keep only unrelated tickets
-            ticketFile << t.userEmail << ","
-                       << t.ticketID << ","
-                       << t.eventName << ","
-                       << t.ticketType << ","
-                       << t.amount << endl;
-        }
-    }
-    ticketFile.close();
+    cout << endl;
+    
+    while(true)
+    {
+        cout << "Enter content (Maximum 50 Characters): ";
+        getline(cin, a.content);
 
-    // Remove all booths for this venue
-    vector<Booth> booths;
-    loadBooths(booths);
-    ofstream boothFile("booth.txt");
-    for (const auto& b : booths) {
-        if (b.venueID != venueID) {
-            boothFile << b.userEmail << ","
-                      << b.venueID << ","
-                      << b.boothID << ","
-                      << (b.isRented ? "1" : "0") << ","
-                      << b.amount << endl;
+        if(a.content == "") {
+            cout << "Content cannot be empty. Please try again.\n\n";
+        } else {
+            if(a.content.length() <= 50) {
+                break;
+            } else {
+                cout << "Content has more than 50 characters. Please try again.\n\n";
+            }
         }
-    }
-    boothFile.close();
 
-    // Remove all sessions for this venue
-    vector<Session> sessions;
-    loadSessions(sessions);
-    ofstream sessionFile("sessions.txt");
-    for (const auto& s : sessions) {
-        if (s.venueID != venueID) {
-            sessionFile << s.sessionID << ","
-                       << s.venueID << ","
-                       << s.exhibitorEmail << ","
-                       << s.topic << ","
-                       << s.timeSlot << endl;
-        }
     }
-    sessionFile.close();
 
-    // Reset the venue
-    for (auto& v : venues) {
-        if (v.venueID == venueID) {
-            v.eventName = "";
-            v.rows = 0;
-            v.columns = 0;
-            v.isAvailable = true;
-            v.ticketType.clear();
-            v.boothType.clear();
-        }
+    // Assign new index
+    int maxIndex = 0;
+    for (auto& an : announcements) {
+        if (an.index > maxIndex) maxIndex = an.index;
     }
-    saveVenues(venues);
+    a.index = maxIndex + 1;
 
-    cout << "Event " << targetEventName << " has been closed and cleared.\n";
-}
+    announcements.push_back(a);
+    walAppend("announcements.txt", announcementLine(a));
+    markDirty(ANNOUNCEMENTS);
 
-void closeEventMenu(vector<Venue>& venues) {
-    // Gather all venues with active events
-    vector<int> closableIndexes;
-    cout << "\nVenues with active events:\n";
-    for (size_t i = 0; i < venues.size(); ++i) {
-        if (!venues[i].isAvailable && !venues[i].eventName.empty()) {
-            cout << closableIndexes.size() + 1 << ". Venue ID: " << venues[i].venueID
-                 << " | Event Name: " << venues[i].eventName << endl;
-            closableIndexes.push_back(i);
-        }
-    }
-    if (closableIndexes.empty()) {
-        cout << "No active events to close.\n";
-        return;
-    }
+    cout << "\n======================================\n";
+    cout << "|| Announcement posted!!!!          ||\n";
+    cout << "======================================\n";
 
-    int closeChoice = getValidatedChoice(0, (int)closableIndexes.size(), "Select the event to close (0 to cancel): ");
+}
+
+void viewAnnouncement(const vector<Announcement>& announcements, const string& userType) {
     
-    if (closeChoice == 0) {
-        cout << "Cancelled.\n";
+    cout << "======================================\n";
+    cout << "||       View Announcements         ||\n";
+    cout << "======================================\n";
+    if (announcements.empty()) {
+        cout << "|| No announcements available.       ||\n";
+        cout << "======================================\n";
+        
         return;
     }
 
-    int venueIdx = closableIndexes[closeChoice - 1];
-    closeEvent(venues[venueIdx].venueID, venues);
-}
+    if (userType == "Admin") {
+        cout << "|| Select the usertype              ||\n";
+        cout << "|| 1. Attendee                      ||\n";
+        cout << "|| 2. Exhibitor                     ||\n";
+        cout << "|| 3. Both                          ||\n";
+        cout << "|| 0. Back                          ||\n";
+        cout << "======================================\n";
+        int choice = getValidatedChoice(0,3, "Choice: ");
 
-void adminEventSelection() {
-    cout << "===========================================\n";
-    cout << "||              Event Menu               ||\n";
-    cout << "===========================================\n";
-    cout << "|| 1. View All Venues & Booked Booths    ||\n";
-    cout << "|| 2. Create New Event                   ||\n";
-    cout << "|| 3. Close Event                        ||\n";
-    cout << "|| 0. Back                               ||\n";
-    cout << "===========================================\n";
-
-    int choice = getValidatedChoice(0, 3, "Choice: ");
-
-    vector<Venue> venues; loadVenues(venues);       
-
-    switch (choice)
-    {
-        case 1: viewAllVenue(venues); break;
-        case 2: viewVenueAvailability(venues); break;
-        case 3: closeEventMenu(venues); break;
-        case 0: return;
-    }
- 
-}
-
-// ==========================
-// SESSION SCHEDULING MODULE
-// ==========================
-void scheduleSession(const string &email) {
-    vector<Booth> booths;
-    loadBooths(booths);
-
-    vector<Session> sessions;
-    loadSessions(sessions);
-
-    Session s;
-    s.sessionID = generateSessionID();
-    s.exhibitorEmail = email;
+        cout << endl;
 
-    // Validate venue
-    string venueID;
-    bool validVenue = false;
-    while (!validVenue) {
-        cout << "Enter Venue ID where you want to schedule a session (0 to cancel): ";
-        getline(cin, venueID);
+        if (choice == 0) { return; }
 
-        if(venueID == "0") return;
+        string filterType;
+        if (choice == 1) filterType = "Attendee";
+        else if (choice == 2) filterType = "Exhibitor";
+        else filterType = "Both";
 
-        // Check exhibitor has booth in that venue
-        bool hasBooth = false;
-        for (const auto& booth : booths) {
-            if (booth.userEmail == email && booth.venueID == venueID) {
-                hasBooth = true;
-                break;
+        bool found = false;
+        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+        cout << "||               Current Announcements for " << left << setw(13) << filterType << "       ||\n";
+        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+        for (const auto& ann : announcements) {
+            if (ann.userType == filterType || ann.userType == "Both" || filterType == "Both") {
+                cout << "|| Index: " << left << setw(52) << ann.index << " ||\n";
+                cout << "|| User Type: " << left << setw(48) << ann.userType << " ||\n";
+                cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
+                cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
+                cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+                found = true;
             }
         }
-
-        if (!hasBooth) {
-            cout << "You do not have a booth in this venue. Please try again.\n\n";
-            continue;
+        if (!found) {
+            cout << "======================================\n";
+            cout << "||     No announcements found       ||\n";
+            cout << "======================================\n";
         }
-
-        // Check if exhibitor already scheduled a session in this venue
-        bool alreadyScheduled = false;
-        for (const auto& sess : sessions) {
-            if (sess.exhibitorEmail == email && sess.venueID == venueID) {
-                alreadyScheduled = true;
-                break;
+    }
+    else {
+        bool found = false;
+        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+        cout << "||               Current Announcements for " << left << setw(13) << userType << "       ||\n";
+        cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+        for (const auto& ann : announcements) {
+            if (ann.userType == userType || ann.userType == "Both") {
+                cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
+                cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
+                cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+                found = true;
             }
         }
-
-        if (alreadyScheduled) {
-            cout << "You already scheduled a session in this venue.\n";
-            return; // exit scheduling
+        if (!found) {
+            cout << "======================================\n";
+            cout << "||     No announcements found       ||\n";
+            cout << "======================================\n";
         }
+    }
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+    
+}
 
-        validVenue = true;
+void editAnnouncement(vector<Announcement>& announcements) {
+    
+    cout << "======================================\n";
+    cout << "||        Edit Announcement         ||\n";
+    cout << "======================================\n";
+    if (announcements.empty()) {
+        cout << "|| No announcements available.       ||\n";
+        cout << "======================================\n";
+        
+        return;
     }
-    s.venueID = venueID;
 
-    do
-    {
-        cout << "Enter Session Topic: ";
-        getline(cin, s.topic);
+    cout << "|| Select the usertype:             ||\n";
+    cout << "|| 1. Attendee                      ||\n";
+    cout << "|| 2. Exhibitor                     ||\n";
+    cout << "|| 3. Both                          ||\n";
+    cout << "|| 0. Back                          ||\n";
+    cout << "======================================\n";
+    int choice = getValidatedChoice(0, 3, "Choice: ");    
 
-        if(!s.topic.empty()) break;
+    cout << endl;
 
-        cout << "Session topic cannot be empty. Please try again.\n\n";
- 
-    } while (s.topic.empty());
-    
+    if (choice == 0) { return; }
 
-    // Validate timeslot
-    string timeSlot;
-    while (true) {
-        cout << "Enter time slot (format HH:MM-HH:MM): ";
-        getline(cin, timeSlot);
+    string filterType;
+    if (choice == 1) filterType = "Attendee";
+    else if (choice == 2) filterType = "Exhibitor";
+    else filterType = "Both";
 
-        if (!isValidTimeSlot(timeSlot)) {
-            cout << "Invalid format or time range. Example valid input: 09:00-10:30\n\n";
-            continue;
+    bool found = false;
+    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+    cout << "||               Current Announcements for " << left << setw(13) << filterType << "       ||\n";
+    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+    for (const auto& ann : announcements) {
+        if (ann.userType == filterType || ann.userType == "Both" || filterType == "Both") {
+            cout << "|| Index: " << left << setw(52) << ann.index << " ||\n";
+            cout << "|| User Type: " << left << setw(48) << ann.userType << " ||\n";
+            cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
+            cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
+            cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+            found = true;
         }
+    }
+    if (!found) {
+        cout << "======================================\n";
+        cout << "||     No announcements found       ||\n";
+        cout << "======================================\n";
+        
+        return;
+    }
 
-        // Clash check
-        bool clash = false;
-        for (const auto& sess : sessions) {
-            if (sess.venueID == venueID && isOverlap(sess.timeSlot, timeSlot)) {
-                clash = true;
-                break;
-            }
-        }
+    int index;
 
-        if (clash) {
-            cout << "This time slot overlaps with another session in this venue. Please try again.\n";
+    while (true) {
+        cout << "\nEnter the index of the announcement to edit (or 0 to go back): ";
+
+        if (!(cin >> index)) {
+            // Input is not an integer
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            cout << "Invalid index. Please enter a valid number.\n";
             continue;
         }
 
-        break; // valid and no clash
+        cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Clear leftover newline
+        break;
     }
-    s.timeSlot = timeSlot;
 
-    // Save session
-    sessions.push_back(s);
-    saveSessions(sessions);
-    cout << "Session scheduled successfully! Session ID: " << s.sessionID << endl;
-}
+    if (index == 0) { return; }
 
-void viewAllSessions() {
-    vector<Session> sessions;
-    loadSessions(sessions);
+    for (auto& ann : announcements) {
+        if (ann.index == index && (ann.userType == filterType || ann.userType == "Both" || filterType == "Both")) {
+            string oldLine = announcementLine(ann);
+            cout << "\nEditing announcement " << index << ": " << ann.title << "\n";
+            cout << "Enter new user type (1. Attendee, 2. Exhibitor, 3. Both, leave blank to keep current): ";
+            string newUserType;
+            getline(cin, newUserType);
+            if (!newUserType.empty()) {
+                if (newUserType == "1") ann.userType = "Attendee";
+                else if (newUserType == "2") ann.userType = "Exhibitor";
+                else if (newUserType == "3") ann.userType = "Both";
+            }
+            
+            cout << "\nEnter new title (Maximum 20 Characters, leave blank to keep current): ";
+            string newTitle;
+            getline(cin, newTitle);
+            if (!newTitle.empty()) {
+                ann.title = newTitle;
+            }
+            cout << "\nEnter new content (Maximum 50 Characters, leave blank to keep current): ";
+            string newContent;
+            getline(cin, newContent);
+            if (!newContent.empty()) {
+                ann.content = newContent;
+            }
+            walReplace("announcements.txt", oldLine, announcementLine(ann));
+            markDirty(ANNOUNCEMENTS);
+            cout << "\n======================================\n";
+            cout << "||Announcement updated successfully! ||\n";
+            cout << "======================================\n";
+            
+            return;
+        }
+    }
+    cout << "=====================================================\n";
+    cout << "|| Announcement not found, returning to dashboard. ||\n";
+    cout << "=====================================================\n";
+}
 
-    if (sessions.empty()) {
-        cout << "No sessions scheduled yet.\n";
+void deleteAnnouncement(vector<Announcement>& announcements) {
+    
+    cout << "======================================\n";
+    cout << "||       Delete Announcement        ||\n";
+    cout << "======================================\n";
+    if (announcements.empty()) {
+        cout << "|| No announcements available.      ||\n";
+        cout << "======================================\n";
+        
         return;
     }
 
-    cout << "All Scheduled Sessions:";
-    for (const auto& s : sessions) {
-        cout << "\n---------------------------------------------------------\n";
-        cout << "SessionID: " << s.sessionID
-             << "\nExhibitor: " << s.exhibitorEmail
-             << "\nVenue: " << s.venueID
-             << "\nTopic: " << s.topic
-             << "\nTime: " << s.timeSlot;
-        cout << "\n\n---------------------------------------------------------\n";
-
-    }
+    cout << "|| Select the usertype:             ||\n";
+    cout << "|| 1. Attendee                      ||\n";
+    cout << "|| 2. Exhibitor                     ||\n";
+    cout << "|| 3. Both                          ||\n";
+    cout << "|| 0. Back                          ||\n";
+    cout << "======================================\n";
+    cout << "Option ->";
+    int choice = getValidatedChoice(0, 3, "Choice: ");    
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+    cout << endl;
 
-}
+    if (choice == 0) { return; }
 
-void viewSessionsByExhibitor(const string& email) {
-    vector<Session> sessions;
-    loadSessions(sessions);
+    string filterType;
+    if (choice == 1) filterType = "Attendee";
+    else if (choice == 2) filterType = "Exhibitor";
+    else filterType = "Both";
 
-    cout << "Your Scheduled Sessions:\n";
     bool found = false;
-    for (const auto& s : sessions) {
-        if (s.exhibitorEmail == email) {   // only show their own sessions
-            cout << "[" << s.sessionID << "] "
-                 << s.topic
-                 << " (Venue " << s.venueID 
-                 << ", Time: " << s.timeSlot << ")\n";
+    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+    cout << "||               Current Announcements for " << left << setw(13) << filterType << "       ||\n";
+    cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
+    for (const auto& ann : announcements) {
+        if (ann.userType == filterType || ann.userType == "Both" || filterType == "Both") {
+            cout << "|| Index: " << left << setw(52) << ann.index << " ||\n";
+            cout << "|| User Type: " << left << setw(48) << ann.userType << " ||\n";
+            cout << "|| Title: " << left << setw(52) << ann.title << " ||\n";
+            cout << "|| Content: " << left << setw(50) << ann.content << " ||\n";
+            cout << setfill('=') << setw(65) << "=" << setfill(' ') << endl;
             found = true;
         }
     }
+    if (!found) {
+        cout << "======================================\n";
+        cout << "||     No announcements found       ||\n";
+        cout << "======================================\n";
+        
+        return;
+    }
+
+    int index;
+
+    while (true) {
+        cout << "\nEnter the index of the announcement to delete (or 0 to go back): ";
+
+        if (!(cin >> index)) {
+            // Input is not an integer
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            cout << "Invalid index. Please enter a valid number.\n";
+            continue;
+        }
+
+        cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Clear leftover newline
+        break;
+    }
+
+    if (index == 0) { return; }
+
+    for (auto it = announcements.begin(); it != announcements.end(); ++it) {
+        if (it->index == index && (it->userType == filterType || it->userType == "Both" || filterType == "Both")) {
+            string line = announcementLine(*it);
+            announcements.erase(it);
+            markDirty(ANNOUNCEMENTS);
+            walRemove("announcements.txt", line);
+            cout << "======================================\n";
+            cout << "||Announcement deleted successfully! ||\n";
+            cout << "======================================\n";
+            
+            return;
+        }
+    }
+    cout << "=====================================================\n";
+    cout << "|| Announcement not found, returning to dashboard. ||\n";
+    cout << "=====================================================\n";
+    
+}
+
+void adminAnnouncementSelection(vector<Announcement> &announcements) {
+    cout << "======================================\n";
+    cout << "||        Announcement Menu         ||\n";
+    cout << "======================================\n";
+    cout << "|| 1. Post Announcement             ||\n";
+    cout << "|| 2. Edit Announcement             ||\n";
+    cout << "|| 3. Delete Announcement           ||\n";
+    cout << "|| 4. View Announcement             ||\n";
+    cout << "|| 0. Back                          ||\n";
+    cout << "======================================\n";
+
+    int choice = getValidatedChoice(0, 4, "Choice: ");
+
+    switch (choice)
+    {
+        case 1: postAnnouncement(announcements); break;
+        case 2: editAnnouncement(announcements); break;
+        case 3: deleteAnnouncement(announcements); break;
+        case 4: viewAnnouncement(announcements, "Admin"); break;
+        case 0: return;
+    }
+}
+
+// ==========================
+// FEEDBACK MODULE
+// ==========================
+void submitFeedback(const string& email, const vector<Ticket> &tickets) {
+        // Only allow feedback for attended events
+        vector<string> attendedEvents;
+        for (size_t pos : userTicketPositions(email)) {
+            const Ticket& t = tickets[pos];
+            if (find(attendedEvents.begin(), attendedEvents.end(), t.eventName) == attendedEvents.end()) {
+                attendedEvents.push_back(t.eventName);
+            }
+        }
+        
+        int eventChoice;
+
+        if (attendedEvents.empty()) {
+            cout << "You have not attended any events yet. Cannot submit feedback.\n";
+            return;
+
+        } else {
+            cout << "Events you attended:\n";
+            for (size_t i = 0; i < attendedEvents.size(); ++i) {
+                cout << i + 1 << ". " << attendedEvents[i] << endl;
+            }
+
+            eventChoice = getValidatedChoice(0, attendedEvents.size(), "Select event to submit feedback for (0 to cancel): ");
+
+            if (eventChoice == 0) {
+                cout << "Cancelled.\n";
+                return;
+            }
+        }
+
+    Feedback feedback;
+    feedback.email = email;
+    feedback.eventName = attendedEvents[eventChoice - 1];
+
+    while (true) {
+        cout << "Enter rating (1-5): ";
+        cin >> feedback.rating;
+        if (cin.fail() || feedback.rating < 1 || feedback.rating > 5) {
+            cout << "\n==============================================\n";
+            cout << "|| Invalid rating. Please enter 1 to 5 only ||\n";
+            cout << "==============================================\n\n";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        } else {
+            break;
+        }
+    }
+
+    cin.ignore();
+    while(true) {
+        cout << "Enter your feedback: ";
+        getline(cin, feedback.comment);
+        if(feedback.comment == "") {
+            cout << "Feedback cannot be empty, please try again.\n\n";
+            continue;
+        }
+
+        break;
+    }
+    
+    cout << "Thank you for your feedback!\n";
+    storeFeedbacks().push_back(feedback);
+    markDirty(FEEDBACK);
+    saveFeedback(feedback);
+}
+
+void viewFeedbacks() {
+    const vector<Feedback>& feedbacks = storeFeedbacks();
+
+    if (feedbacks.empty()) {
+        cout << "No feedback available." << endl;
+    } else {
+        cout << "\n===================================================\n";
+        cout << "||         Feedback Ratings and Comments         ||\n";
+        cout << "===================================================\n";
+        for (size_t i = 0; i < feedbacks.size(); ++i) {
+            cout << "\n================\n";
+            cout << "|| Feedback " << i + 1 << " ||\n";
+            cout << "================\n";
+            cout << "Email: " << feedbacks[i].email << endl;
+            cout << "Event: " << feedbacks[i].eventName << endl;
+            cout << "Rating: " << feedbacks[i].rating << endl;
+            cout << "Comment: " << feedbacks[i].comment << endl;
+        }
+    }
+
+    cout << "\nPress Enter to continue...";
+    cin.ignore();
+}
+
+void deleteFeedback() {
+    vector<Feedback>& feedbacks = storeFeedbacks();
+
+    if (feedbacks.empty()) {
+        cout << "No feedback to delete." << endl;
+        return;
+    }
+
+    // Display feedbacks
+    cout << "\n===================================================\n";
+    cout << "||         Feedback Ratings and Comments         ||\n";
+    cout << "===================================================\n";
+    for (size_t i = 0; i < feedbacks.size(); ++i) {
+        cout << "\n================\n";
+        cout << "|| Feedback " << i + 1 << " ||\n";
+        cout << "================\n";
+        cout << "Email: " << feedbacks[i].email << endl;
+        cout << "Event: " << feedbacks[i].eventName << endl;
+        cout << "Rating: " << feedbacks[i].rating << endl;
+        cout << "Comment: " << feedbacks[i].comment << endl;
+    }
+
+    // Ask user which to delete
+    int choice;
+    choice = getValidatedChoice(0, feedbacks.size(), "Enter which feedback you want to delete (0 to cancel): ");
+
+    if (choice == 0) {
+        cout << "Delete cancelled.\n";
+        return;
+    }
+
+    // Remove selected feedback
+    string line = feedbackLine(feedbacks[choice - 1]);
+    feedbacks.erase(feedbacks.begin() + (choice - 1));
+    markDirty(FEEDBACK);
+    walRemove("feedback.txt", line);
+
+    cout << "====================================\n";
+    cout << "|| Feedback deleted successfully! ||\n";
+    cout << "====================================\n\n";
+
+}
+
+void adminFeedbackSelection() {
+    cout << "===========================================\n";
+    cout << "||             Feedback Menu             ||\n";
+    cout << "===========================================\n";
+    cout << "|| 1. View Feedbacks                     ||\n";
+    cout << "|| 2. Delete Inappropriate Feedback      ||\n";
+    cout << "|| 0. Back                               ||\n";
+    cout << "===========================================\n";
+
+    int choice = getValidatedChoice(0, 2, "Choice: ");
+
+    switch (choice)
+    {
+        case 1: viewFeedbacks(); break;
+        case 2: deleteFeedback(); break;
+        case 0: return;
+    }
+
+}
+
+// ==========================
+// TICKET MODULE
+// ==========================
+// Buys qty tickets of one type as a single commit: every ticket line and
+// the new sold count go to the log in one write. Returns false when fewer
+// than qty tickets are left. firstTicket, if given, receives the number of
+// the first ticket ID; the rest follow it.
+bool purchaseTickets(size_t venueIndex, size_t typeIndex, const string& email, int qty, int* firstTicket = nullptr) {
+    STAT_TIMER(timer, "purchaseTickets");
+    StoreFileLock storeFiles;
+    syncCollections({TICKETS, VENUES});
+    vector<Venue>& venues = storeVenues();
+    if (venueIndex >= venues.size() || qty < 1) return false;
+    Venue& v = venues[venueIndex];
+    if (v.isAvailable || typeIndex >= v.ticketType.size()) return false;
+    TicketType& tt = v.ticketType[typeIndex];
+
+    // Check, reserve and log under the type's lock: buyers racing for the
+    // last seats cannot oversell, and the sold counts reach the log in order.
+    // In atomic inventory mode the reservation is a compare-and-swap instead
+    // and the log orders the counter records itself.
+    unique_lock<mutex> inventory(ticketTypeLock(venueIndex, typeIndex), defer_lock);
+    if (atomicInventory) {
+        if (!reserveTickets(ticketsLeftFor(venueIndex, typeIndex), qty)) return false;
+    } else {
+        inventory.lock();
+        if (tt.capacity - tt.sold < qty) return false;
+        tt.sold += qty;
+        tt.revenue += qty * tt.price;
+    }
+
+    // Reserve the ID range before anything is written
+    int firstID = allocateIds('T', qty);
+
+    // Interned once, outside the append lock
+    Ticket t;
+    t.userEmail = email;
+    t.eventName = v.eventName;
+    t.ticketType = tt.type;
+    t.amount = tt.price;
+
+    vector<WalRecord> records;
+    records.reserve(qty + 1);
+    {
+        lock_guard<mutex> append(appendMutex);
+        for (int i = 0; i < qty; ++i) {
+            t.ticketID = formatId('T', firstID + i);
+            addStoreTicket(t);
+            records.push_back({'A', "ticket.txt", ticketLine(t)});
+        }
+        markDirty(TICKETS);
+    }
+
+    if (atomicInventory) {
+        walWrite(records, [&] { return venueTicketStatsRecord(venueIndex, typeIndex, loggedTicketType(venueIndex, typeIndex, qty)); });
+    } else {
+        records.push_back(venueTicketStatsRecord(venueIndex, typeIndex, tt));
+        walWrite(records);
+        updateVenueTicketStats(venueIndex, typeIndex, tt.sold, tt.revenue);
+    }
+    if (firstTicket) *firstTicket = firstID;
+    return true;
+}
+
+void purchaseTicket(vector<Venue>& venues, const string& email) {
+    STAT_TIMER(timer, "purchaseTicket");
+    refreshCollections({VENUES});
+    cout << "Available Events:\n";
+    for (size_t i = 0; i < venues.size(); ++i) {
+        if (!venues[i].isAvailable && !venues[i].eventName.empty())
+            cout << i+1 << ". " << venues[i].eventName << " (Venue " << venues[i].venueID << ")\n";
+    }
+
+    int choice = getValidatedChoice(0, venues.size(), "Select event (0 to cancel): ");
+
+    if(choice == 0) {
+        cout << "Purchasing ticket cancelled.\n";
+        return;
+    }
+
+    Venue& v = venues[choice-1];
+    if(v.isAvailable) return;
+    cout << "Ticket Types:\n";
+    for (size_t i = 0; i < v.ticketType.size(); ++i) {
+        cout << i+1 << ". " << v.ticketType[i].type << " (RM" << v.ticketType[i].price << ", Remaining: " << (v.ticketType[i].capacity - v.ticketType[i].sold) << ")\n";
+    }
+
+    int ttype = getValidatedChoice(0, v.ticketType.size(), "Select ticket type (0 to cancel): ");
+    if(ttype == 0) {
+        cout << "Purchasing ticket cancelled.\n";
+        return;
+    }
+    
+    int qty = getValidatedChoice(1, (v.ticketType[ttype-1].capacity - v.ticketType[ttype-1].sold), "Quantity: ");
+    if (!purchaseTickets(choice-1, ttype-1, email, qty)) {
+        cout << "Not enough tickets left.\n";
+        return;
+    }
+    cout << "Tickets purchased successfully!\n";
+}
+
+void viewPurchasedTickets(const vector<Ticket>& tickets, const string& email) {
+    cout << "Your Tickets:\n";
+    bool found = false;
+    for (size_t pos : userTicketPositions(email)) {
+        const Ticket& t = tickets[pos];
+        cout << "Ticket ID: " << t.ticketID << ", Event: " << t.eventName << ", Type: " << t.ticketType << ", Amount: RM" << t.amount << endl;
+        found = true;
+    }
+    if (!found) cout << "No tickets found.\n";
+    cout << "Press Enter to continue...";
+    cin.ignore();
+}
+
+// Refunds one ticket as a single commit: the ticket line, the refund log
+// line and the new sold count go to the log in one write. Returns false when
+// the attendee holds no ticket with that ID.
+bool refundTicketByID(const string& email, const string& ticketID, double& amount) {
+    StoreFileLock storeFiles;
+    syncCollections({TICKETS, VENUES});
+    vector<Ticket>& tickets = storeTickets();
+
+    // Remove ticket and write the refund log in one log write
+    vector<WalRecord> records;
+    Symbol eventName, ticketType;
+    bool found = false;
+    for (size_t pos : userTicketPositions(email)) {
+        const Ticket& t = tickets[pos];
+        if (t.ticketID == ticketID) {
+            found = true;
+            eventName = t.eventName;
+            ticketType = t.ticketType;
+            amount = t.amount;
+            records.push_back({'D', "ticket.txt", ticketLine(t)});
+            records.push_back({'A', "Ticketrefunds.txt", ticketLine(t) + ",REFUNDED"});
+            removeStoreTicket(pos);
+            break;
+        }
+    }
+    if (!found) return false;
+    markDirty(TICKETS);
+
+    // Update venue ticketType sold count in the same log write
+    vector<Venue>& venues = storeVenues();
+    vector<pair<size_t, size_t>> soldUpdates;
+    for (size_t i = 0; i < venues.size(); ++i) {
+        if (venues[i].eventName == eventName) {
+            for (size_t j = 0; j < venues[i].ticketType.size(); ++j) {
+                TicketType& tt = venues[i].ticketType[j];
+                if (tt.type == ticketType && tt.sold > 0) {
+                    tt.sold -= 1;
+                    tt.revenue -= amount;
+                    releaseTickets(i, j, 1);
+                    records.push_back(venueTicketStatsRecord(i, j, tt));
+                    soldUpdates.push_back({i, j});
+                }
+            }
+            break;
+        }
+    }
+    walWrite(records);
+    for (const auto& u : soldUpdates) {
+        const TicketType& tt = venues[u.first].ticketType[u.second];
+        updateVenueTicketStats(u.first, u.second, tt.sold, tt.revenue);
+    }
+    return true;
+}
+
+void refundTicket(const string& email) {
+    STAT_TIMER(timer, "refundTicket");
+    refreshCollections({TICKETS});
+    vector<Ticket>& tickets = storeTickets();
+
+    // Show user's tickets
+    vector<Ticket> userTickets;
+    for (size_t pos : userTicketPositions(email)) {
+        userTickets.push_back(tickets[pos]);
+    }
+    if (userTickets.empty()) {
+        cout << "You have no tickets to refund.\n";
+        return;
+    }
+    cout << "Your tickets:\n";
+    for (size_t i = 0; i < userTickets.size(); ++i) {
+        cout << i+1 << ". Ticket ID: " << userTickets[i].ticketID
+             << ", Event: " << userTickets[i].eventName
+             << ", Type: " << userTickets[i].ticketType
+             << ", Amount: RM" << fixed << setprecision(2) << userTickets[i].amount << endl;
+    }
+    
+    int choice = getValidatedChoice(0, (int)userTickets.size(), "Enter which ticket you to refund (0 to cancel): ");
+    if (choice == 0) {
+        cout << "Refund cancelled.\n";
+        return;
+    }
+
+    double amount = 0.0;
+    if (!refundTicketByID(email, userTickets[choice-1].ticketID, amount)) {
+        cout << "Ticket not found or not owned by user.\n";
+        return;
+    }
+    cout << "Refund amount: RM" << fixed << setprecision(2) << amount << endl;
+}
+
+void attendeeTicketSelection(const string& email) {
+    cout << "===========================================\n";
+    cout << "||             Ticket Menu               ||\n";
+    cout << "===========================================\n";
+    cout << "|| 1. View Purchased Tickets             ||\n";
+    cout << "|| 2. Refund Ticket                      ||\n";
+    cout << "|| 0. Back                               ||\n";
+    cout << "===========================================\n";
+
+    int choice = getValidatedChoice(0, 2, "Choice: ");
+
+    switch (choice)
+    {
+        case 1: viewPurchasedTickets(storeTickets(), email); break;
+        case 2: refundTicket(email); break;
+        case 0: return;
+    }
+}
+
+// ==========================
+// BOOTH MODULE
+// ==========================
+void displayBoothLayout(const Venue& venue) {
+    cout << "Booth layout for " << venue.eventName << ": " << endl;
+    const BoothOccupancy& occupied = venueOccupancy(venue.venueID);
+    cout << "    ";
+    for (int j =  0; j < venue.columns; j++) {
+        char colLetter = 'A' + j;
+        cout << colLetter << "    ";
+    }
+    cout << endl;
+    for (int i = 0; i < venue.rows; i++) {
+        cout << i+1 << "  ";
+        for (int j = 0; j < venue.columns; j++) {
+            bool booked = occupied.test(boothGridIndex(i, j));
+            cout << (booked ? "[x]" : "[ ]");
+            if (j < venue.columns - 1) cout << "  ";
+        }
+        cout << endl;
+    }
+}
+
+// Rents one booth as a single commit: the booth line and the venue's booth
+// totals go to the log in one write. Returns false when the event is not
+// running, the booth ID is not on its grid or the booth is taken.
+bool rentBooth(size_t venueIndex, const string& typedID, const string& email) {
+    const string boothID = canonicalBoothID(typedID);
+    StoreFileLock storeFiles;
+    syncCollections({BOOTHS, VENUES});
+    vector<Venue>& venues = storeVenues();
+    if (venueIndex >= venues.size()) return false;
+    Venue& v = venues[venueIndex];
+    if (v.isAvailable || !isValidBoothID(v, boothID)) return false;
+
+    // The occupancy check and everything after it run under the venue's
+    // booth lock, so two exhibitors cannot both get the same booth
+    lock_guard<mutex> inventory(venueBoothLock(venueIndex));
+    if (isBoothOccupied(v.venueID, boothID)) return false;
+
+    BoothType* boothType = findBoothType(v, boothID);
+    double price = boothType ? boothType->price : 0.0;
+
+    Booth b;
+    b.userEmail = email;
+    b.venueID = v.venueID;
+    b.boothID = boothID;
+    b.amount = price;
+    b.isRented = true;
+    {
+        lock_guard<mutex> append(appendMutex);
+        addStoreBooth(b);
+        markDirty(BOOTHS);
+    }
+
+    // The booth line and the venue's booth totals commit in one log write
+    if (boothType) boothType->isRented = true;
+    v.boothsRented++;
+    v.boothRevenue += price;
+    WalRecord stats = venueBoothStatsRecord(venueIndex, v);
+    walWrite({{'A', "booth.txt", boothLine(b)}, stats});
+    applyVenueWalRecord(stats);
+    return true;
+}
+
+void bookBooth(vector<Venue>& venues, const string& email) {
+    STAT_TIMER(timer, "bookBooth");
+    refreshCollections({BOOTHS, VENUES});
+    cout << "Available Venues:\n";
+    for (size_t i = 0; i < venues.size(); ++i) {
+        if (!venues[i].isAvailable && !venues[i].eventName.empty())
+            cout << i+1 << ". " << venues[i].eventName << " (Venue " << venues[i].venueID << ")\n";
+    }
+    int choice = getValidatedChoice(0, venues.size(), "Select venue (0 to cancel): ");
+    if (choice == 0) return;
+    
+    Venue& v = venues[choice-1];
+
+    if(v.isAvailable) return;
+
+    displayBoothLayout(v);
+
+    string boothID; 
+    while(true) {
+        cout << "Enter booth ID to rent (e.g. A1, B2): ";
+        getline(cin, boothID);
+        
+        boothID[0] = toupper(boothID[0]);
+
+        if (!isValidBoothID(v, boothID)) {
+            cout << "Invalid booth ID.\n\n";
+            continue;
+        }
+        boothID = canonicalBoothID(boothID);
+        if (isBoothOccupied(v.venueID, boothID)) {
+            cout << "Booth already booked.\n\n";
+            continue;
+        }
+        break;
+    }
+
+    BoothType* boothType = findBoothType(v, boothID);
+    double price = boothType ? boothType->price : 0.0;
+    cout << "Booth price: RM" << fixed << setprecision(2) << price << endl;
+    
+    char confirm;
+    while(true) {
+        cout << "Confirm rental of booth " << boothID << "? (y/n): ";
+        cin >> confirm;
+        cin.ignore();
+
+        if(confirm == 'Y' || confirm == 'N' || confirm == 'y' || confirm == 'n') break;
+
+        cout << "Invalid input. Please try again.\n\n";
+    }
+
+    if(confirm == 'N' || confirm == 'n') {
+        cout << "Booth rental cancelled.\n";
+        return;
+    }
+
+    if (!rentBooth(choice-1, boothID, email)) {
+        cout << "Booth already booked.\n";
+        return;
+    }
+    cout << "Booth booked successfully!\n";
+}
+
+void viewBooth(const string& email){
+    const vector<Booth>& booths = storeBooths();
+    bool found = false;
+    for (size_t pos : userBoothPositions(email)) {
+        const Booth& booth = booths[pos];
+        if (booth.isRented) {
+            found = true;
+            cout << endl;
+            cout << "Booth ID: " << booth.boothID << endl;
+            cout << "Venue ID: " << booth.venueID << endl;
+            cout << "Amount: $" << fixed << setprecision(2) << booth.amount << endl;
+            cout << "--------------------------" << endl;
+        }
+    }
+    if (!found) {
+        cout << "No booths found for this email." << endl;
+    }
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+void viewAllBookedBooths(const string &venueID) {
+    const vector<Booth>& booths = storeBooths();
+    Symbol venue = Symbol::existing(venueID);
+
+    for (const auto& b : booths) {
+        if (b.isRented && b.venueID == venue) {
+            cout << "Booth ID: " << b.boothID << ", User Email: " << b.userEmail << endl;
+        }
+    }
+}
+
+// Refunds a rented booth as a single commit: the booth line, the refund log
+// line and the venue's booth totals go to the log in one write. Returns
+// false when the exhibitor does not rent that booth.
+bool refundBoothByID(const string& email, const string& venueID, const string& typedID, double& amount) {
+    const string boothID = canonicalBoothID(typedID);
+    StoreFileLock storeFiles;
+    syncCollections({BOOTHS, VENUES});
+    vector<Booth>& booths = storeBooths();
+
+    // Mark booth as not rented and write the refund log in one log write
+    vector<WalRecord> records;
+    bool found = false;
+    int refunded = 0;
+    double refundedAmount = 0.0;
+    for (size_t pos : userBoothPositions(email)) {
+        Booth& b = booths[pos];
+        // Compared in stored form, so rows saved as typed still match
+        if (b.venueID == venueID && b.isRented && canonicalBoothID(b.boothID) == boothID) {
+            found = true;
+            string oldLine = boothLine(b);
+            b.isRented = false; // Mark as not rented
+            setBoothOccupied(b.venueID, b.boothID, false);
+            records.push_back({'R', "booth.txt", oldLine + WAL_FIELD_SEP + boothLine(b)});
+
+            stringstream refundLine;
+            refundLine << b.userEmail << "," << b.boothID << "," << b.venueID << "," << b.amount << ",REFUNDED";
+            records.push_back({'A', "boothRefunds.txt", refundLine.str()});
+            refunded++;
+            refundedAmount += b.amount;
+        }
+    }
+    if (!found) return false;
+    amount = refundedAmount;
+    markDirty(BOOTHS);
+
+    // Update venue boothType isRented status and booth totals in the same log write
+    vector<Venue>& venues = storeVenues();
+    size_t venueIndex = findVenueIndex(venues, venueID);
+    if (venueIndex < venues.size()) {
+        Venue& v = venues[venueIndex];
+        BoothType* bt = findBoothType(v, boothID);
+        if (bt) bt->isRented = false;
+        v.boothsRented = max(0, v.boothsRented - refunded);
+        v.boothRevenue -= refundedAmount;
+        records.push_back(venueBoothStatsRecord(venueIndex, v));
+    }
+    walWrite(records);
+    if (venueIndex < venues.size()) applyVenueWalRecord(records.back());
+    return true;
+}
+
+void refundBooth(const string& email) {
+    STAT_TIMER(timer, "refundBooth");
+    refreshCollections({BOOTHS});
+    vector<Booth>& booths = storeBooths();
+
+    // Show user's booths
+    vector<Booth> userBooths;
+    for (size_t pos : userBoothPositions(email)) {
+        if (booths[pos].isRented) userBooths.push_back(booths[pos]);
+    }
+    if (userBooths.empty()) {
+        cout << "You have no booths to refund.\n";
+        return;
+    }
+    cout << "Your rented booths:\n";
+    for (size_t i = 0; i < userBooths.size(); ++i) {
+        cout << i+1 << ". Booth ID: " << userBooths[i].boothID
+             << ", Venue ID: " << userBooths[i].venueID
+             << ", Amount: RM" << fixed << setprecision(2) << userBooths[i].amount << endl;
+    }
+
+    int choice = getValidatedChoice(0, (int)userBooths.size(), "Enter which booth you want to refund (0 to cancel): ");
+    if (choice == 0) {
+        cout << "Refund cancelled.\n";
+        return;
+    }
+
+    double amount = 0.0;
+    if (!refundBoothByID(email, userBooths[choice-1].venueID, userBooths[choice-1].boothID, amount)) {
+        cout << "Booth not found or not owned by user.\n";
+        return;
+    }
+    cout << "Refund amount: RM" << fixed << setprecision(2) << amount << endl;
+}
+
+void exhibitorBoothSelection(const string& email) {
+    cout << "===========================================\n";
+    cout << "||              Booth Menu               ||\n";
+    cout << "===========================================\n";
+    cout << "|| 1. View Booked Booths                 ||\n";
+    cout << "|| 2. Refund Booth                       ||\n";
+    cout << "|| 0. Back                               ||\n";
+    cout << "===========================================\n";
+
+    int choice = getValidatedChoice(0, 2, "Choice: ");
+
+    switch (choice)
+    {
+        case 1: viewBooth(email); break;
+        case 2: refundBooth(email); break;
+        case 0: return;
+    }
+}
+
+// ==========================
+// VENUE MODULE
+// ==========================
+// Fills the booth grid row by row: A1, B1, ..., A2, ...
+void layoutVenueBooths(Venue& venue, double boothPrice) {
+    venue.boothType.clear();
+    for (int i = 0; i < venue.rows; i++) {
+        for (int j = 0; j < venue.columns; j++) {
+            BoothType bt;
+            bt.boothID = string(1, 'A' + j) + to_string(i + 1);
+            bt.price = boothPrice;
+            bt.isRented = false; 
+            venue.boothType.push_back(bt);
+        }
+    }
+}
+
+// Opens an event on a free venue. The booking menu prompts within the same
+// limits, so from there only the venue or the name can fail. Returns false
+// with the reason in problem.
+bool createEvent(size_t venueIndex, const string& eventName, int rows, int columns,
+                 double boothPrice, const vector<TicketType>& ticketTypes, string& problem) {
+    StoreFileLock storeFiles;
+    syncCollections({VENUES});
+    vector<Venue>& venues = storeVenues();
+    problem = "invalid value: ";
+    if (venueIndex >= venues.size() || !venues[venueIndex].isAvailable) {
+        problem = "the venue is taken";
+        return false;
+    }
+    if (eventName.empty() || eventName.length() >= EVENT_NAME_LEN) {
+        problem += "event name must be 1 to " + to_string(EVENT_NAME_LEN - 1) + " characters";
+        return false;
+    }
+    if (rows < 1 || rows > MAX_BOOTH_ROWS || columns < 1 || columns > MAX_BOOTH_COLS || boothPrice <= 0) {
+        problem += "rows and columns must be 1 to " + to_string(MAX_BOOTH_ROWS) + ", booth price above 0";
+        return false;
+    }
+    if (ticketTypes.empty() || ticketTypes.size() > (size_t)MAX_TICKET_TYPES) {
+        problem += "an event needs 1 to " + to_string(MAX_TICKET_TYPES) + " ticket types";
+        return false;
+    }
+    for (const auto& t : ticketTypes) {
+        if (t.type.empty() || t.type.length() >= TICKET_TYPE_NAME_LEN || t.price < 0 || t.capacity < 0) {
+            problem += "ticket type names must be 1 to " + to_string(TICKET_TYPE_NAME_LEN - 1) +
+                       " characters, prices and capacities not negative";
+            return false;
+        }
+    }
+    for (const auto& t : venues) {
+        if (t.eventName == eventName) { // tickets find their event by name
+            problem = "an event with that name already exists";
+            return false;
+        }
+    }
+
+    Venue& venue = venues[venueIndex];
+    venue.eventName = eventName;
+    venue.rows = rows;
+    venue.columns = columns;
+    layoutVenueBooths(venue, boothPrice);
+    venue.ticketType = ticketTypes;
+    for (auto& t : venue.ticketType) {
+        t.sold = 0;
+        t.revenue = 0;
+    }
+    venue.boothsRented = 0;
+    venue.boothRevenue = 0;
+    venue.isAvailable = false;
+    saveVenueRecord(venueIndex, venue);
+    syncTicketInventory(venueIndex);
+    return true;
+}
+
+void makeNewVenueBooking(Venue& venue) {
+    cin.clear();
+    cout << "Please enter the details for the new venue booking. (0 to cancel)" << endl;
+    string eventName;
+
+    do{
+        cout << "\nEnter the name for the event: ";
+        getline(cin, eventName);
+        if (eventName == "0") {
+            cout << "Booking cancelled.\n" << endl;
+            return;
+        }
+
+        if(eventName.empty()) {
+            cout << "Event name cannot be empty, please try again.\n";
+        } else if (eventName.length() >= EVENT_NAME_LEN) {
+            cout << "Event name must be under " << EVENT_NAME_LEN << " characters, please try again.\n";
+            eventName.clear();
+        }
+    } while(eventName.empty());
+
+    venue.eventName = eventName;
+
+
+    cout << "\nEnter the number of rows and columns of booths to be added (Maximum 10 rows and 10 columns).\n";
+    int rows = getValidatedChoice(0, 10, "Rows: ");
+    if (rows == 0 ) {
+        cout << "Booking cancelled." << endl;
+        return;
+    }
+    venue.rows = rows;
+
+    int cols = getValidatedChoice(0, 10, "Columns: ");
+    if (cols == 0) {
+        cout << "Booking cancelled." << endl;
+        return;
+    }
+    venue.columns = cols;
+
+    double boothPrice;
+    while(true) {
+        cout << "\nEnter booth price (fixed for the event): RM ";
+
+        if(!(cin >> boothPrice)) {
+            cout << "Invalid booth price, please enter a valid number.\n";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            continue;
+        }
+
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        break;
+    }
+
+    if (boothPrice <= 0) {
+        cout << "Booking cancelled." << endl;
+        return;
+    }
+
+    layoutVenueBooths(venue, boothPrice);
+
+    int ticketTypes;
+    while(true) {
+        cout << "\nEnter the number of ticket types: ";
+
+        if(!(cin >> ticketTypes)) {
+            cout << "Invalid ticket type, please enter a valid number.\n\n";
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            continue;
+        }
+       
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        break;
+    }
+
+    if (ticketTypes <= 0) {
+        cout << "Booking cancelled." << endl;
+        return;
+    }
+    if (ticketTypes > MAX_TICKET_TYPES) {
+        cout << "At most " << MAX_TICKET_TYPES << " ticket types are supported, using " << MAX_TICKET_TYPES << ".\n";
+        ticketTypes = MAX_TICKET_TYPES;
+    }
+    
+    venue.ticketType.clear();
+    for (int i = 0; i < ticketTypes; ++i) {
+        TicketType t;
+        cout << "\nEnter details for ticket type " << i + 1 << ":" << endl;
+
+        while (true) {
+            cout << "Type: ";
+            getline(cin, t.type); 
+            if (t.type.empty()) {
+                cout << "Ticket type cannot be empty, please try again.\n";
+            } else if (t.type.length() >= TICKET_TYPE_NAME_LEN) {
+                cout << "Ticket type must be under " << TICKET_TYPE_NAME_LEN << " characters, please try again.\n";
+            } else break;
+        }
+
+        while (true) {
+            cout << "Price: RM";
+            if (!(cin >> t.price) || t.price < 0) {
+                cout << "Invalid price, please enter a number of 0 or more.\n";
+                cin.clear();
+                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                continue;
+            }
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            break;
+        }
+
+        while (true) {
+            cout << "Capacity: ";
+            if (!(cin >> t.capacity) || t.capacity < 0) {
+                cout << "Invalid capacity, please enter a whole number of 0 or more.\n";
+                cin.clear();
+                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                continue;
+            }
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            break;
+        }
+
+        t.sold = 0;
+        venue.ticketType.push_back(t);
+    }
+    if (venue.ticketType.empty()) {
+        cout << "No ticket types added. Booking cancelled." << endl;
+        return;
+    }
+    venue.isAvailable = false;
+    cout << "New event created successfully." << endl;
+}
+
+void viewVenueAvailability(vector<Venue>& venues) {
+    cout << "Venues: " << endl;
+    for (size_t i = 0; i < venues.size(); i++) {
+        if (venues[i].isAvailable) {
+            cout << i + 1 << ". Venue " << venues[i].venueID << endl;
+        }
+    }
+
+    int choice;
+    while(true) {
+        cout << "Enter the venue no. of your choice (enter 0 to cancel): ";
+        if(!(cin >> choice) || choice < 0 || choice > venues.size() || !venues[choice - 1].isAvailable) {
+            cout << "Invalid or already booked venue." << endl;
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            continue;
+        }
+
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        break;
+
+    }
+
+    if (choice == 0) {
+        cout << "Booking cancelled." << endl;
+        cin.ignore();
+        return;
+    }
+
+    // Filled in on a copy, since another kiosk may book the venue meanwhile;
+    // createEvent checks again against the current venue file
+    Venue draft = venues[choice - 1];
+    makeNewVenueBooking(draft);
+    if (draft.isAvailable) return; // cancelled
+
+    double boothPrice = draft.boothType.empty() ? 0 : draft.boothType[0].price;
+    string problem;
+    if (!createEvent(choice - 1, draft.eventName, draft.rows, draft.columns, boothPrice, draft.ticketType, problem)) {
+        cout << "Venue " << draft.venueID << " could not be booked: " << problem << "." << endl;
+        return;
+    }
+    cout << "Venue " << venues[choice - 1].venueID << " booked successfully." << endl;
+}
+
+void viewAllVenue(const vector<Venue>& venues) {
+    bool hasVenue = false;
+    for (const auto& v : venues) {
+        if (!v.eventName.empty()) {
+            hasVenue = true;
+            break;
+        }
+    }
+    if (!hasVenue) {
+        cout << "No venues have been created yet." << endl;
+        return;
+    }
+    for (const auto& v : venues) {
+        if (!v.venueID.empty() && !v.isAvailable) {
+            cout << "Venue ID: " << v.venueID << endl;
+            cout << "Event Name: " << v.eventName << endl;
+            displayBoothLayout(v);
+            cout << endl;
+            viewAllBookedBooths(v.venueID);
+            cin.ignore();
+        }
+    }
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+bool closeEvent(const string& venueID, vector<Venue>& venues) {
+    STAT_TIMER(timer, "closeEvent");
+    StoreFileLock storeFiles;
+    syncCollections({TICKETS, BOOTHS, SESSIONS, VENUES});
+    // Find the event name for the given venue ID
+    string targetEventName = "";
+    for (const auto& v : venues) {
+        if (v.venueID == venueID) {
+            targetEventName = v.eventName;
+            break;
+        }
+    }
+
+    if (targetEventName.empty()) {
+        cout << "Event not found." << endl;
+        return false;
+    }
+
+    vector<WalRecord> records;
+
+    // Remove all tickets for this event
+    vector<Ticket>& tickets = storeTickets();
+    Symbol event = Symbol::existing(targetEventName);
+    Symbol venue = Symbol::existing(venueID);
+    for (const auto& t : tickets) {
+        if (t.eventName == event) {
+            records.push_back({'D', "ticket.txt", ticketLine(t)});
+        }
+    }
+    tickets.erase(remove_if(tickets.begin(), tickets.end(),
+        [&](const Ticket& t) { return t.eventName == event; }), tickets.end());
+    rebuildTicketIndex();
+
+    // Remove all booths for this venue
+    vector<Booth>& booths = storeBooths();
+    for (const auto& b : booths) {
+        if (b.venueID == venue) {
+            records.push_back({'D', "booth.txt", boothLine(b)});
+        }
+    }
+    booths.erase(remove_if(booths.begin(), booths.end(),
+        [&](const Booth& b) { return b.venueID == venue; }), booths.end());
+    rebuildBoothIndex();
+
+    // Remove all sessions for this venue
+    vector<Session>& sessions = storeSessions();
+    for (const auto& s : sessions) {
+        if (s.venueID == venue) {
+            records.push_back({'D', "sessions.txt", sessionLine(s)});
+        }
+    }
+    sessions.erase(remove_if(sessions.begin(), sessions.end(),
+        [&](const Session& s) { return s.venueID == venue; }), sessions.end());
+    store.sessionSchedule.erase(venueID);
+
+    markDirty(TICKETS);
+    markDirty(BOOTHS);
+    markDirty(SESSIONS);
+    walWrite(records);
+
+    // Reset the venue
+    for (size_t i = 0; i < venues.size(); ++i) {
+        Venue& v = venues[i];
+        if (v.venueID == venueID) {
+            v.eventName = "";
+            v.rows = 0;
+            v.columns = 0;
+            v.isAvailable = true;
+            v.ticketType.clear();
+            v.boothType.clear();
+            v.boothsRented = 0;
+            v.boothRevenue = 0;
+            saveVenueRecord(i, v);
+            syncTicketInventory(i);
+        }
+    }
+
+    cout << "Event " << targetEventName << " has been closed and cleared.\n";
+    return true;
+}
+
+void closeEventMenu(vector<Venue>& venues) {
+    // Gather all venues with active events
+    vector<int> closableIndexes;
+    cout << "\nVenues with active events:\n";
+    for (size_t i = 0; i < venues.size(); ++i) {
+        if (!venues[i].isAvailable && !venues[i].eventName.empty()) {
+            cout << closableIndexes.size() + 1 << ". Venue ID: " << venues[i].venueID
+                 << " | Event Name: " << venues[i].eventName << endl;
+            closableIndexes.push_back(i);
+        }
+    }
+    if (closableIndexes.empty()) {
+        cout << "No active events to close.\n";
+        return;
+    }
+
+    int closeChoice = getValidatedChoice(0, (int)closableIndexes.size(), "Select the event to close (0 to cancel): ");
+    
+    if (closeChoice == 0) {
+        cout << "Cancelled.\n";
+        return;
+    }
+
+    int venueIdx = closableIndexes[closeChoice - 1];
+    closeEvent(venues[venueIdx].venueID, venues);
+}
+
+void adminEventSelection() {
+    cout << "===========================================\n";
+    cout << "||              Event Menu               ||\n";
+    cout << "===========================================\n";
+    cout << "|| 1. View All Venues & Booked Booths    ||\n";
+    cout << "|| 2. Create New Event                   ||\n";
+    cout << "|| 3. Close Event                        ||\n";
+    cout << "|| 4. Export Venues to CSV               ||\n";
+    cout << "|| 5. Import Venues from CSV             ||\n";
+    cout << "|| 0. Back                               ||\n";
+    cout << "===========================================\n";
+
+    int choice = getValidatedChoice(0, 5, "Choice: ");
+
+    vector<Venue>& venues = storeVenues();
+
+    switch (choice)
+    {
+        case 1: viewAllVenue(venues); break;
+        case 2: viewVenueAvailability(venues); break;
+        case 3: closeEventMenu(venues); break;
+        case 4:
+            exportVenuesCSV(venues);
+            cout << "Venues exported to venue.txt.\n";
+            break;
+        case 5:
+            importVenuesCSV(venues);
+            saveVenues(venues);
+            cout << "Venues imported from venue.txt.\n";
+            break;
+        case 0: return;
+    }
+ 
+}
+
+// ==========================
+// SESSION SCHEDULING MODULE
+// ==========================
+bool hasBoothInVenue(const string& email, const string& venueID) {
+    const vector<Booth>& booths = storeBooths();
+    Symbol venue = Symbol::existing(venueID);
+    for (size_t pos : userBoothPositions(email)) {
+        if (booths[pos].venueID == venue) return true;
+    }
+    return false;
+}
+
+bool hasSessionInVenue(const string& email, const string& venueID) {
+    Symbol exhibitor = Symbol::existing(email), venue = Symbol::existing(venueID);
+    for (const auto& sess : storeSessions()) {
+        if (sess.exhibitorEmail == exhibitor && sess.venueID == venue) return true;
+    }
+    return false;
+}
+
+// Checks the same rules as the scheduling menu, then gives the session its
+// ID and saves it. Returns false when any rule fails.
+bool addSession(Session& s) {
+    StoreFileLock storeFiles;
+    syncCollections({SESSIONS, BOOTHS});
+    int start, end;
+    if (s.topic.empty() || !hasBoothInVenue(s.exhibitorEmail, s.venueID) ||
+        hasSessionInVenue(s.exhibitorEmail, s.venueID) ||
+        !isValidTimeSlot(s.timeSlot) || !parseTimeSlot(s.timeSlot, start, end) ||
+        sessionSlotClashes(s.venueID, start, end)) {
+        return false;
+    }
+    s.sessionID = allocateId('S');
+
+    // Save session
+    storeSessions().push_back(s);
+    addSessionSlot(s);
+    markDirty(SESSIONS);
+    walAppend("sessions.txt", sessionLine(s));
+    return true;
+}
+
+void scheduleSession(const string &email) {
+    Session s;
+    s.exhibitorEmail = email;
+
+    // Validate venue
+    string venueID;
+    bool validVenue = false;
+    while (!validVenue) {
+        cout << "Enter Venue ID where you want to schedule a session (0 to cancel): ";
+        getline(cin, venueID);
+
+        if(venueID == "0") return;
+
+        // Check exhibitor has booth in that venue
+        if (!hasBoothInVenue(email, venueID)) {
+            cout << "You do not have a booth in this venue. Please try again.\n\n";
+            continue;
+        }
+
+        // Check if exhibitor already scheduled a session in this venue
+        if (hasSessionInVenue(email, venueID)) {
+            cout << "You already scheduled a session in this venue.\n";
+            return; // exit scheduling
+        }
+
+        validVenue = true;
+    }
+    s.venueID = venueID;
+
+    do
+    {
+        cout << "Enter Session Topic: ";
+        getline(cin, s.topic);
+
+        if(!s.topic.empty()) break;
+
+        cout << "Session topic cannot be empty. Please try again.\n\n";
+ 
+    } while (s.topic.empty());
+    
+
+    cout << "Free time slots in this venue:";
+    for (const auto& gap : freeSessionSlots(venueID)) {
+        cout << " " << minutesToTime(gap.first) << "-" << minutesToTime(gap.second);
+    }
+    cout << endl;
+
+    // Validate timeslot
+    string timeSlot;
+    while (true) {
+        cout << "Enter time slot (format HH:MM-HH:MM): ";
+        getline(cin, timeSlot);
+
+        if (!isValidTimeSlot(timeSlot)) {
+            cout << "Invalid format or time range. Example valid input: 09:00-10:30\n\n";
+            continue;
+        }
+
+        // Clash check
+        int start, end;
+        parseTimeSlot(timeSlot, start, end);
+        if (sessionSlotClashes(venueID, start, end)) {
+            cout << "This time slot overlaps with another session in this venue. Please try again.\n";
+            continue;
+        }
+
+        break; // valid and no clash
+    }
+    s.timeSlot = timeSlot;
+    // Checked again under the store lock: another kiosk may have taken the
+    // slot or scheduled this exhibitor in the venue since the prompts
+    if (!addSession(s)) {
+        cout << "The venue's schedule was changed at another kiosk. Please try again.\n";
+        return;
+    }
+    cout << "Session scheduled successfully! Session ID: " << s.sessionID << endl;
+}
+
+void viewAllSessions() {
+    const vector<Session>& sessions = storeSessions();
+
+    if (sessions.empty()) {
+        cout << "No sessions scheduled yet.\n";
+        return;
+    }
+
+    cout << "All Scheduled Sessions:";
+    for (const auto& s : sessions) {
+        cout << "\n---------------------------------------------------------\n";
+        cout << "SessionID: " << s.sessionID
+             << "\nExhibitor: " << s.exhibitorEmail
+             << "\nVenue: " << s.venueID
+             << "\nTopic: " << s.topic
+             << "\nTime: " << s.timeSlot;
+        cout << "\n\n---------------------------------------------------------\n";
+
+    }
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+void viewSessionsByExhibitor(const string& email) {
+    const vector<Session>& sessions = storeSessions();
+
+    cout << "Your Scheduled Sessions:\n";
+    bool found = false;
+    Symbol exhibitor = Symbol::existing(email);
+    for (const auto& s : sessions) {
+        if (s.exhibitorEmail == exhibitor) {   // only show their own sessions
+            cout << "[" << s.sessionID << "] "
+                 << s.topic
+                 << " (Venue " << s.venueID 
+                 << ", Time: " << s.timeSlot << ")\n";
+            found = true;
+        }
+    }
+
+    if (!found) {
+        cout << "You have not scheduled any sessions yet.\n";
+    }
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+void viewSessionsByAttendee(const string& email) {
+    refreshCollections({TICKETS, VENUES, SESSIONS});
+
+    // 1. Load attendee's tickets
+    const vector<Ticket>& tickets = storeTickets();
+
+    // 2. Load venues 
+    const vector<Venue>& venues = storeVenues();
+
+    // 3. Collect all venueIDs that the attendee joined (via eventName in tickets)
+    set<string> joinedVenueIDs;
+    for (size_t pos : userTicketPositions(email)) {
+        for (const auto& v : venues) {
+            if (v.eventName == tickets[pos].eventName) {
+                joinedVenueIDs.insert(v.venueID);
+            }
+        }
+    }
+
+    if (joinedVenueIDs.empty()) {
+        cout << "You have not joined any events yet.\n";
+        return;
+    }
+
+    // 4. Load sessions
+    const vector<Session>& sessions = storeSessions();
+
+    // 5. Display only sessions matching the attendee's joined venues
+    cout << "Sessions available for events you joined:\n";
+    bool found = false;
+    for (const auto& s : sessions) {
+        if (joinedVenueIDs.find(s.venueID) != joinedVenueIDs.end()) {
+            cout << "[" << s.sessionID << "] "
+                 << s.topic << " (Venue " << s.venueID
+                 << ", Time: " << s.timeSlot << ")\n";
+            found = true;
+        }
+    }
+
+    if (!found) {
+        cout << "No sessions scheduled yet for the events you joined.\n";
+    }
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+// Position of the session whose line is still oldLine once caught up with
+// other kiosks, or SIZE_MAX if it was changed or removed meanwhile. Call
+// with the store files locked.
+size_t findUnchangedSession(const string& oldLine) {
+    syncCollections({SESSIONS});
+    const vector<Session>& sessions = storeSessions();
+    for (size_t i = 0; i < sessions.size(); ++i) {
+        if (sessionLine(sessions[i]) == oldLine) return i;
+    }
+    return SIZE_MAX;
+}
+
+void updateSession(const string& email) {
+    vector<Session>& sessions = storeSessions();
+
+    // Show exhibitor's sessions
+    vector<int> ownedIndexes;
+    cout << "Your Scheduled Sessions:\n";
+    Symbol exhibitor = Symbol::existing(email);
+    for (int i = 0; i < sessions.size(); i++) {
+        if (sessions[i].exhibitorEmail == exhibitor) {
+            cout << i+1 << ". [" << sessions[i].sessionID << "] "
+                 << sessions[i].topic << " at Venue " << sessions[i].venueID
+                 << " (" << sessions[i].timeSlot << ")\n";
+            ownedIndexes.push_back(i);
+        }
+    }
+
+    if (ownedIndexes.empty()) {
+        cout << "You have no sessions to update.\n";
+        return;
+    }
+
+    int choice = getValidatedChoice(0, ownedIndexes.size(), "Enter the number of the session you want to update (0 to cancel): ");
+    if (choice == 0) {
+        cout << "Update cancelled.\n";
+        return;
+    }
+
+    // Edited on a copy and saved only if nobody changed it meanwhile
+    Session edited = sessions[ownedIndexes[choice - 1]];
+    string oldLine = sessionLine(edited);
+
+    cout << "Enter new topic (leave empty to keep current): ";
+    string newTopic;
+    getline(cin, newTopic);
+    if (!newTopic.empty()) edited.topic = newTopic;
+
+    // Validate new time slot
+    string newSlot;
+    while (true) {
+        cout << "Enter new time slot (HH:MM-HH:MM, leave empty to keep current): ";
+        getline(cin, newSlot);
+
+        if (newSlot.empty()) break;
+
+        if (!isValidTimeSlot(newSlot)) {
+            cout << "Invalid time format. Example: 09:00-10:30\n";
+            continue;
+        }
+
+        // Check clash with other sessions
+        int start, end;
+        parseTimeSlot(newSlot, start, end);
+        if (sessionSlotClashes(edited.venueID, start, end, edited.sessionID)) {
+            cout << "Time slot overlaps with another session. Please try again.\n";
+            continue;
+        }
+
+        edited.timeSlot = newSlot;
+        break;
+    }
+
+    if (sessionLine(edited) != oldLine) {
+        StoreFileLock storeFiles;
+        size_t pos = findUnchangedSession(oldLine);
+        int start, end;
+        if (pos == SIZE_MAX || (parseTimeSlot(edited.timeSlot, start, end) &&
+                                sessionSlotClashes(edited.venueID, start, end, edited.sessionID))) {
+            cout << "The session or its venue's schedule was changed at another kiosk. Please try again.\n";
+            return;
+        }
+        removeSessionSlot(sessions[pos]);
+        sessions[pos] = edited;
+        addSessionSlot(sessions[pos]);
+        markDirty(SESSIONS);
+        walReplace("sessions.txt", oldLine, sessionLine(edited));
+    }
+    cout << "Session updated successfully.\n";
+}
+
+void deleteSession(const string& email) {
+    vector<Session>& sessions = storeSessions();
+
+    // Show exhibitor's sessions
+    vector<int> ownedIndexes;
+    cout << "Your Scheduled Sessions:\n";
+    Symbol exhibitor = Symbol::existing(email);
+    for (int i = 0; i < sessions.size(); i++) {
+        if (sessions[i].exhibitorEmail == exhibitor) {
+            cout << i+1 << ". [" << sessions[i].sessionID << "] "
+                 << sessions[i].topic<< " at Venue " << sessions[i].venueID
+                 << " (" << sessions[i].timeSlot << ")\n";
+            ownedIndexes.push_back(i);
+        }
+    }
+
+    if (ownedIndexes.empty()) {
+        cout << "You have no sessions to delete.\n";
+        return;
+    }
+
+    int choice = getValidatedChoice(0, ownedIndexes.size(), "Enter the number of the session you want to delete (0 to cancel): ");
+    if (choice == 0) {
+        cout << "Deletion cancelled.\n";
+        return;
+    }
+
+    int idx = ownedIndexes[choice - 1];
+    cout << "Are you sure you want to delete session [" << sessions[idx].sessionID << "] (Y/N)? ";
+    char confirm;
+    cin >> confirm;
+    cin.ignore();
+
+    if (confirm == 'y' || confirm == 'Y') {
+        StoreFileLock storeFiles;
+        string line = sessionLine(sessions[idx]);
+        size_t pos = findUnchangedSession(line);
+        if (pos == SIZE_MAX) {
+            cout << "The session was changed or removed at another kiosk.\n";
+            return;
+        }
+        removeSessionSlot(sessions[pos]);
+        sessions.erase(sessions.begin() + pos);
+        markDirty(SESSIONS);
+        walRemove("sessions.txt", line);
+        cout << "Session deleted successfully.\n";
+    } else {
+        cout << "Deletion cancelled.\n";
+    }
+}
+
+void ExhibitorSessionSelection(const string& email) {
+    cout << "===========================================\n";
+    cout << "||              Session Menu             ||\n";
+    cout << "===========================================\n";
+    cout << "|| 1. View All Session Scheduled         ||\n";
+    cout << "|| 2. Update Session Detail              ||\n";
+    cout << "|| 3. Delete Session                     ||\n";
+    cout << "|| 0. Back                               ||\n";
+    cout << "===========================================\n";
+
+    int choice = getValidatedChoice(0, 3, "Choice: ");
+
+    switch (choice)
+    {
+        case 1: viewSessionsByExhibitor(email); break;
+        case 2: updateSession(email); break;
+        case 3: deleteSession(email); break;
+        case 0: return;
+    }
+ 
+}
+
+// ==========================
+// MONITORING MODULE
+// ==========================
+int venueTicketsSold(const Venue& v) {
+    int sold = 0;
+    for (const auto& tt : v.ticketType) sold += tt.sold;
+    return sold;
+}
+
+double venueTicketRevenue(const Venue& v) {
+    double revenue = 0.0;
+    for (const auto& tt : v.ticketType) revenue += tt.revenue;
+    return revenue;
+}
+
+void monitorExhibitorStats(const string& exhibitorEmail) {
+
+    const vector<Booth>& booths = storeBooths();
+    const vector<Session>& sessions = storeSessions();
+
+    cout << "\n========================================================\n";
+    cout << "||         Exhibitor Monitoring Dashboard             ||\n";
+    cout << "========================================================\n";
+
+    cout << "Exhibitor: " << exhibitorEmail;
+
+    cout << "\n=============================\n";
+    cout << "||       Booth Stats       ||\n";
+    cout << "=============================\n";
+
+    bool boothFound = false;
+    for (size_t pos : userBoothPositions(exhibitorEmail)) {
+        const Booth& booth = booths[pos];
+        cout << "Venue: " << booth.venueID << endl
+             << "Booth: " << booth.boothID << endl
+             << "Amount Paid: RM" << fixed << setprecision(2) << booth.amount << endl
+             << "Status: " << (booth.isRented ? "Rented" : "Refunded") << endl
+             << endl;
+        boothFound = true;
+    }
+    if (!boothFound) {
+        cout << "No booths booked yet.\n";
+    }
+
+    cout << "==============================\n";
+    cout << "||    Scheduled Sessions    ||\n";
+    cout << "==============================\n";
+
+    bool sessionFound = false;
+    Symbol exhibitor = Symbol::existing(exhibitorEmail);
+    for (const auto& session : sessions) {
+        if (session.exhibitorEmail == exhibitor) {
+            cout << "Session ID: " << session.sessionID << endl
+                 << "Venue: " << session.venueID << endl
+                 << "Topic: " << session.topic << endl
+                 << "Time Slot: " << session.timeSlot << endl
+                 << endl;
+            sessionFound = true;
+        }
+    }
+    if (!sessionFound) {
+        cout << "No sessions scheduled yet.\n";
+    }
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+void monitorAdminStats() {
+
+    const vector<Session>& sessions = storeSessions();
+    const vector<Venue>& venues = storeVenues();
+
+    int totalSold = 0;
+    for (const auto& v : venues) totalSold += venueTicketsSold(v);
+    if (totalSold == 0) {
+        cout << "No ticket sales data available.\n";
+        return;
+    }
+
+    cout << "\n==================================\n";
+    cout << "||     Monitor Venue Stat       ||\n";
+    cout << "==================================\n";
+
+    for (size_t i = 0; i < venues.size(); i++) {
+        cout << i + 1 << ". " << venues[i].venueID << " - " << venues[i].eventName << endl;
+    }
+
+    cout << endl;
+
+    int choice = getValidatedChoice(0, venues.size(), "Enter the number of the venue to view stats: ");
+    
+    if (choice == 0) {
+        cout << "Returning to dashboard.\n\n";
+        return;
+    }
+
+    Venue selectedVenue = venues[choice - 1];
+
+    cout << "\nMonitoring: Venue " << selectedVenue.venueID << " - " << selectedVenue.eventName << endl;
+
+    // ticket sales
+    cout << "==========================================\n";
+    cout << "||         Ticket Sales Summary         ||\n";
+    cout << "==========================================\n";
+    cout << "Total Tickets Sold: " << venueTicketsSold(selectedVenue) << endl;
+    cout << "Total Ticket Revenue: RM " << fixed << setprecision(2) << venueTicketRevenue(selectedVenue) << endl;
+    for (const auto& tt : selectedVenue.ticketType) {
+        cout << " - " << tt.type << ": " << tt.sold << " sold, RM " << fixed << setprecision(2) << tt.revenue << endl;
+    }
+
+    // booth sales
+    cout << "==========================================\n";
+    cout << "||          Booth Sales Summary         ||\n";
+    cout << "==========================================\n";
+    cout << "Total Booths Rented: " << selectedVenue.boothsRented << endl;
+    cout << "Total Booth Revenue: RM " << fixed << setprecision(2) << selectedVenue.boothRevenue << endl;
+    displayBoothLayout(selectedVenue);
+
+    // sessions scheduled
+    cout << "==========================================\n";
+    cout << "||           Sessions Summary           ||\n";
+    cout << "==========================================\n";
+    bool foundSession = false;
+    Symbol venue = Symbol::existing(selectedVenue.venueID);
+    for (const auto& session : sessions) {
+        if (session.venueID == venue) {
+            cout << "[" << session.sessionID << "] " << session.topic << " at " << session.timeSlot << " (Exhibitor: " << session.exhibitorEmail << ")\n";
+            foundSession = true;
+        }
+    }
+    if (!foundSession) {
+        cout << " - No sessions scheduled yet.\n";
+    }
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+// ==========================
+// REPORTING MODULE
+// ==========================
+void generateEventReport(const string& venueID, const vector<Session>& sessions, const vector<Venue>& venues) {
+    
+    // Find venue
+    auto it = find_if(venues.begin(), venues.end(),
+        [&](const Venue& v) { return v.venueID == venueID; });
+
+    if (it == venues.end() || it->eventName.empty()) {
+        cout << "[ERROR] Venue not found or no event assigned.\n";
+        return;
+    }
+
+    const Venue& venue = *it;
+    cout << "\n=========================================\n";
+    cout << "FINAL REPORT FOR EVENT: " << venue.eventName << "\n";
+    cout << "Venue ID: " << venue.venueID << "\n";
+    cout << "=========================================\n";
+
+    // --- Ticket Summary ---
+    double totalTicketRevenue = venueTicketRevenue(venue);
+    cout << "Ticket Sales Summary\n";
+    cout << "Total Tickets Sold : " << venueTicketsSold(venue) << endl;
+    cout << "Total Ticket Revenue: RM " << fixed << setprecision(2) << totalTicketRevenue << "\n";
+    for (const auto& tt : venue.ticketType) {
+        cout << "   - " << tt.type << ": " << tt.sold << " sold, RM " << fixed << setprecision(2) << tt.revenue << "\n";
+    }
+
+    // --- Booth Summary ---
+    double totalBoothRevenue = venue.boothRevenue;
+    cout << "\nBooth Rental Summary\n";
+    cout << "Total Booths Rented : " << venue.boothsRented << endl;
+    cout << "Total Booth Revenue : RM " << fixed << setprecision(2) << totalBoothRevenue << "\n";
+
+    // --- Session Summary ---
+    cout << "\nSessions Summary\n";
+    bool hasSessions = false;
+    Symbol venueSymbol = Symbol::existing(venue.venueID);
+    for (const auto& s : sessions) {
+        if (s.venueID == venueSymbol) {
+            cout << "   - [" << s.sessionID << "] "
+                 << s.topic << " | Time: " << s.timeSlot
+                 << " | Exhibitor: " << s.exhibitorEmail << "\n";
+            hasSessions = true;
+        }
+    }
+    if (!hasSessions) cout << "   No sessions scheduled.\n";
+
+    // --- Grand Total ---
+    double grandTotal = totalTicketRevenue + totalBoothRevenue;
+    cout << "\nGRAND TOTAL REVENUE: RM " << fixed << setprecision(2) << grandTotal << endl;
+    cout << "=========================================\n";
+    cout << "         END OF FINAL REPORT              \n";
+    cout << "=========================================\n";
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+string reportFilename(const Venue& venue) {
+    return venue.eventName + " Event Report.txt";
+}
+
+// Final report file contents for one venue and the sessions held there
+string renderReport(const Venue& venue, const vector<const Session*>& sessions) {
+    stringstream file;
+    file << "========== FINAL REPORT ==========\n";
+    file << "Event: " << venue.eventName << "\n";
+    file << "Venue: " << venue.venueID << "\n";
+
+    // Tickets
+    double totalTicketRevenue = venueTicketRevenue(venue);
+    file << "\nTicket Sales:\n";
+    file << "Total Tickets Sold : " << venueTicketsSold(venue) << "\n";
+    file << "Total Ticket Revenue: RM " << fixed << setprecision(2) << totalTicketRevenue << "\n";
+    for (const auto& tt : venue.ticketType) {
+        file << " - " << tt.type << ": " << tt.sold << " sold, RM " << fixed << setprecision(2) << tt.revenue << "\n";
+    }
+
+    // Booths
+    double totalBoothRevenue = venue.boothRevenue;
+    file << "\nBooth Rentals:\n";
+    file << "Total Booths Rented : " << venue.boothsRented << "\n";
+    file << "Total Booth Revenue : RM " << fixed << setprecision(2) << totalBoothRevenue << "\n";
+
+    // Sessions
+    file << "\nSessions Summary:\n";
+    for (const Session* s : sessions) {
+        file << " - [" << s->sessionID << "] " << s->topic
+             << " | Time: " << s->timeSlot
+             << " | Exhibitor: " << s->exhibitorEmail << "\n";
+    }
+    if (sessions.empty()) file << "No sessions scheduled.\n";
+
+    // Grand Total
+    double grandTotal = totalTicketRevenue + totalBoothRevenue;
+    file << "\nGRAND TOTAL REVENUE: RM " << fixed << setprecision(2) << grandTotal << "\n";
+    file << "========== END OF REPORT ==========\n";
+    return file.str();
+}
+
+bool writeReportFile(const Venue& venue, const vector<const Session*>& venueSessions) {
+    STAT_TIMER(timer, "exportReport");
+    ofstream file(reportFilename(venue));
+    if (!file.is_open()) return false;
+    string report = renderReport(venue, venueSessions);
+    file << report;
+    timer.wrote(report.size());
+    return file.good();
+}
+
+void exportReportToFile(const string& venueID, const vector<Session>& sessions, const vector<Venue>& venues) {
+    
+    auto it = find_if(venues.begin(), venues.end(),
+        [&](const Venue& v) { return v.venueID == venueID; });
+
+    if (it == venues.end() || it->eventName.empty()) {
+        cout << "[ERROR] Venue not found or no event assigned.\n";
+        return;
+    }
+
+
+    const Venue& venue = *it;
+    vector<const Session*> venueSessions;
+    Symbol venueSymbol = Symbol::existing(venue.venueID);
+    for (const auto& s : sessions) {
+        if (s.venueID == venueSymbol) venueSessions.push_back(&s);
+    }
+    if (!writeReportFile(venue, venueSessions)) {
+        cout << "[ERROR] Unable to create report file.\n";
+        return;
+    }
+    cout << "[INFO] Final report for " << venue.eventName << " exported to " << reportFilename(venue) << endl;
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+
+}
+
+// Splits the sessions by venue in one pass, then renders and writes every
+// event's report on a pool of worker threads
+void exportAllReports(const vector<Session>& sessions, const vector<Venue>& venues) {
+    auto start = chrono::steady_clock::now();
+
+    unordered_map<string, size_t> venueIndex;
+    vector<size_t> events;
+    for (size_t i = 0; i < venues.size(); ++i) {
+        if (venues[i].eventName.empty()) continue;
+        venueIndex[venues[i].venueID] = i;
+        events.push_back(i);
+    }
+    if (events.empty()) {
+        cout << "[ERROR] No events to report on.\n";
+        return;
+    }
+
+    vector<vector<const Session*>> venueSessions(venues.size());
+    for (const auto& s : sessions) {
+        auto it = venueIndex.find(s.venueID);
+        if (it != venueIndex.end()) venueSessions[it->second].push_back(&s);
+    }
+
+    // Each worker claims the next unreported event until none are left
+    atomic<size_t> next(0);
+    vector<char> written(events.size(), 0);
+    auto worker = [&]() {
+        for (size_t e = next++; e < events.size(); e = next++) {
+            written[e] = writeReportFile(venues[events[e]], venueSessions[events[e]]) ? 1 : 0;
+        }
+    };
+
+    size_t threadCount = max(1u, thread::hardware_concurrency());
+    threadCount = min(threadCount, events.size());
+    vector<thread> pool;
+    for (size_t i = 0; i < threadCount; ++i) pool.emplace_back(worker);
+    for (auto& t : pool) t.join();
+
+    for (size_t e = 0; e < events.size(); ++e) {
+        const Venue& venue = venues[events[e]];
+        if (written[e]) cout << "[INFO] Final report for " << venue.eventName << " exported to " << reportFilename(venue) << endl;
+        else cout << "[ERROR] Unable to create report file for " << venue.eventName << ".\n";
+    }
+    cout << "[INFO] " << events.size() << " reports exported in " << fixed << setprecision(1)
+         << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() << " ms using "
+         << threadCount << " threads.\n";
+
+    cout << "\nPress Enter to continue...\n";
+    cin.ignore();
+}
+
+void adminReportSelection() {
+    const vector<Session>& sessions = storeSessions();
+    const vector<Venue>& venues = storeVenues();
+
+    cout << "===========================================\n";
+    cout << "||            Reporting Menu             ||\n";
+    cout << "===========================================\n";
+
+    cout << "Available Events:\n";
+    for (const auto& v : venues) {
+        if (!v.eventName.empty())
+            cout << " - Venue " << v.venueID << ": " << v.eventName << endl;
+    }
+
+    cout << "\n1. View Report on Screen\n";
+    cout << "2. Export Report to File\n";
+    cout << "3. Export All Event Reports\n";
+    int choice = getValidatedChoice(0, 3, "Choice (0 to return): ");
+    if (choice == 0) return;
+    if (choice == 3) {
+        exportAllReports(sessions, venues);
+        return;
+    }
+
+    string venueID;
+    cout << "\nEnter Venue ID to generate report: ";
+    getline(cin, venueID);
+    transform(venueID.begin(), venueID.end(), venueID.begin(), ::toupper);
+
+    switch (choice)
+    {
+        case 1: generateEventReport(venueID, sessions, venues); break;
+        case 2: exportReportToFile(venueID, sessions, venues); break;
+    }
+
+
+}
+// ==========================
+// PROFILE DASHBOARD
+// ==========================
+void attendeeDashboard(Attendee &a, vector<Announcement> &annc, vector<UserCredential> &credentials) {
+    while (true) {
+        cout << "\n=====================================================\n";
+        cout << "||               Attendee Dashboard                ||\n";
+        cout << "=====================================================\n";
+        cout << "|| 1. View Profile                                 ||\n";
+        cout << "|| 2. Update Profile                               ||\n";
+        cout << "|| 3. Delete Account                               ||\n";
+        cout << "|| 4. View Event Announcements                     ||\n";
+        cout << "|| 5. Purchase Tickets                             ||\n";
+        cout << "|| 6. Manage Purchased Tickets                     ||\n";
+        cout << "|| 7. Submit Feedbacks                             ||\n";
+        cout << "|| 8. View Available Sessions                      ||\n";
+        cout << "|| 0. Logout                                       ||\n";
+        cout << "=====================================================\n";
+        cout << "Choice: ";
+
+        string choice;
+        getline(cin, choice);
+
+        if (choice == "1") { // View Profile
+            viewAttendeeProfile(a);
+            cout << "Press Enter to return to dashboard...";
+            cin.ignore();
+        }
+        else if (choice == "2") { // Update Profile
+            updateAttendeeProfile(a, credentials);
+            
+        }
+        else if (choice == "3") { // Delete Profile
+            deleteAttendeeProfile(a);
+            break;
+            
+        }
+        else if (choice == "4") { // View Announcement
+            viewAnnouncement(annc, "Attendee");
+        }
+        else if (choice == "5") { // Purchase Ticket
+            purchaseTicket(storeVenues(), a.email);
+
+        }
+        else if (choice == "6") { // Manage Ticket
+            attendeeTicketSelection(a.email);
+        }
+        else if (choice == "7") { // Submit Feedbacks
+            submitFeedback(a.email, storeTickets());
+
+        }
+        else if (choice == "8") { // View Sessions
+            viewSessionsByAttendee(a.email);
+        }
+        else if (choice == "0") {
+            cout << "Logging out...\n";
+            break;
+        } else cout << "Invalid choice.\n";
+    }
+}
+
+void exhibitorDashboard(Exhibitor &e, vector<Announcement> &annc, vector<UserCredential> &credentials) {
+    while (true) {
+        cout << "\n=====================================================\n";
+        cout << "||               Exhibitor Dashboard               ||\n";
+        cout << "=====================================================\n";
+        cout << "|| 1. View Profile                                 ||\n";
+        cout << "|| 2. Update Profile                               ||\n";
+        cout << "|| 3. Delete Account                               ||\n";
+        cout << "|| 4. View Event Announcements                     ||\n";
+        cout << "|| 5. Book Booths                                  ||\n";
+        cout << "|| 6. Manage Booked Booths                         ||\n";
+        cout << "|| 7. Schedule Sessions                            ||\n";
+        cout << "|| 8. Manage Sessions Scheduled                    ||\n";
+        cout << "|| 9. Monitor Booth/Session Stats                  ||\n";
+        cout << "|| 0. Logout                                       ||\n";
+        cout << "=====================================================\n";
+        cout << "Choice: ";
+
+        string choice;
+        getline(cin, choice);
+
+        if (choice == "1") { // View Profile
+            viewExhibitorProfile(e);
+            cout << "Press Enter to return to dashboard...";
+            cin.ignore();
+        }
+        else if (choice == "2") { // Update Profile
+            updateExhibitorProfile(e, credentials);
+
+        }
+        else if (choice == "3") { // Delete Profile
+            deleteExhibitorProfile(e);
+            break;
+
+        }
+        else if (choice == "4") { // View Announcement
+            viewAnnouncement(annc, "Exhibitor");
+        }
+        else if (choice == "5") { // Book Booth
+            bookBooth(storeVenues(), e.email);
+        }
+        else if (choice == "6") { // Manage Booth
+            exhibitorBoothSelection(e.email); 
+        }
+        else if (choice == "7") { // Schedule Session
+            scheduleSession(e.email);
+        }
+        else if (choice == "8") { // Manage Session
+            ExhibitorSessionSelection(e.email);
+        }
+        else if (choice == "9") { // Monitor Stats
+            monitorExhibitorStats(e.email);
+        }
+        else if (choice == "0") {
+            cout << "Logging out...\n";
+            break;
+        } else cout << "Invalid choice.\n";
+    }
+}
+
+void adminPerformanceStats() {
+    cout << "\n=====================================================\n";
+    cout << "||               Performance Stats                 ||\n";
+    cout << "=====================================================\n";
+    if (!statsEnabled) {
+        cout << "Collection is off (set EXPO_STATS=1 before starting to record from launch).\n";
+        cout << "Turn it on now? (Y/N): ";
+        string answer;
+        getline(cin, answer);
+        if (answer == "Y" || answer == "y") {
+            statsEnabled = true;
+            cout << "Collection turned on.\n";
+        }
+        return;
+    }
+
+    printStats(cout);
+    cout << "\n1. Reset counters\n2. Turn collection off\n0. Back\n";
+    int choice = getValidatedChoice(0, 2, "Choice: ");
+    if (choice == 1) {
+        resetStats();
+        cout << "Counters reset.\n";
+    } else if (choice == 2) {
+        statsEnabled = false;
+        cout << "Collection turned off.\n";
+    }
+}
+
+void adminDashboard(Admin &ad, vector<Announcement> &annc, vector<UserCredential> &credentials) {
+
+    while (true) {
+        cout << "\n=====================================================\n";
+        cout << "||                 Admin Dashboard                 ||\n";
+        cout << "=====================================================\n";
+        cout << "|| 1. View Profile                                 ||\n"; 
+        cout << "|| 2. Update Profile                               ||\n"; 
+        cout << "|| 3. Manage Event Announcements                   ||\n"; 
+        cout << "|| 4. Manage Event Venues                          ||\n";
+        cout << "|| 5. View Sessions                                ||\n"; 
+        cout << "|| 6. Manage Feedbacks                             ||\n"; 
+        cout << "|| 7. Monitor Ticket/Booth/Session Stats           ||\n"; 
+        cout << "|| 8. Manage Reports                               ||\n"; 
+        cout << "|| 9. View Performance Stats                       ||\n";
+        cout << "|| 0. Logout                                       ||\n";
+        cout << "=====================================================\n";
+        cout << "Choice: ";
+
+        string choice;
+        getline(cin, choice);
+
+        if (choice == "1") { // View Profile
+            viewAdminProfile(ad);
+            cout << "Press Enter to return to dashboard...";
+            cin.ignore();
+        }
+        else if (choice == "2") { // Update Profile
+            updateAdminProfile(ad, credentials);
+        }
+        else if (choice == "3") { // Manage Announcement
+            adminAnnouncementSelection(annc);
+        }
+        else if (choice == "4") { // Manage Event Venues
+            adminEventSelection();
+        }
+        else if (choice == "5") { // View Sessions
+            viewAllSessions();
+        }
+        else if (choice == "6") { // Manage Feedbacks
+            adminFeedbackSelection();
+        }
+        else if (choice == "7") { // Monitor Stats
+            monitorAdminStats();
+        }
+        else if (choice == "8") { // Manage Report
+            adminReportSelection();
+        }
+        else if (choice == "9") { // Performance Stats
+            adminPerformanceStats();
+        }
+        else if (choice == "0") {
+            cout << "Logging out...\n";
+            break;
+        } else cout << "Invalid choice.\n";
+    }
+}
+
+// ==========================
+// MENUS
+// ==========================
+void mainLogo() {
+    cout << "============================================================\n";
+    cout << "||                                                        ||\n";
+    cout << "||          _____                    _____                ||\n";
+    cout << "||         /\\    \\                  /\\    \\               ||\n";
+    cout << "||        /::\\    \\                /::\\____\\              ||\n";
+    cout << "||       /::::\\    \\              /:::/    /              ||\n";
+    cout << "||      /::::::\\    \\            /:::/    /               ||\n";
+    cout << "||     /:::/\\:::\\    \\          /:::/    /                ||\n";
+    cout << "||    /:::/  \\:::\\    \\        /:::/____/                 ||\n";
+    cout << "||   /:::/    \\:::\\    \\       ||::|    |                 ||\n";
+    cout << "||  /:::/    / \\:::\\    \\      ||::|    |     _____       ||\n";
+    cout << "|| /:::/    /   \\:::\\    \\     ||::|    |    /\\    \\      ||\n";
+    cout << "||/:::/____/     \\:::\\____\\    ||::|    |   /:::\\____\\    ||\n";
+    cout << "||\\:::\\    \\      \\::/    /    ||::|    |  /:::/    /     ||\n";
+    cout << "|| \\:::\\    \\      \\/____/     ||::|    | /:::/    /      ||\n";
+    cout << "||  \\:::\\    \\                 ||::|____|/:::/    /       ||\n";
+    cout << "||   \\:::\\    \\                ||:::::::::::/    /        ||\n";
+    cout << "||    \\:::\\    \\               \\::::::::::/____/          ||\n";
+    cout << "||     \\:::\\    \\               ~~~~~~~~~~                ||\n";
+    cout << "||      \\:::\\    \\                                        ||\n";
+    cout << "||       \\:::\\____\\                                       ||\n";
+    cout << "||        \\::/    /                                       ||\n";
+    cout << "||         \\/____/                                        ||\n";
+    cout << "||                                                        ||\n";
+    cout << "============================================================\n";
+    cout << "||                       WELCOME TO                       ||\n";
+    cout << "||              EXPO EVENT MANAGEMENT SYSTEM              ||\n";
+    cout << "============================================================\n\n";
+
+}
+
+void mainMenu() {
+    vector<UserCredential>& credentials = storeCredentials();
+    vector<Announcement>& announcements = storeAnnouncements();
+
+    while (true) {
+
+        mainLogo();
+        cout << "============================================================\n";
+        cout << "|| Please select one of the options below for logins:     ||\n";
+        cout << "============================================================\n";
+        cout << "|| 1. Attendee Login                                      ||\n";
+        cout << "|| 2. Exhibitor Login                                     ||\n";
+        cout << "|| 3. Admin Login                                         ||\n";
+        cout << "|| 4. Sign Up                                             ||\n";
+        cout << "|| 0. Exit                                                ||\n";
+        cout << "============================================================\n";
+        cout << "Choice: ";
 
-    if (!found) {
-        cout << "You have not scheduled any sessions yet.\n";
-    }
+        string choice; getline(cin, choice);
+        cout << endl;
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+        if (choice == "1") {
+            string attendeeEmail = login("Attendee");
+            if(attendeeEmail != "") {
+                Attendee attendee = findAttendee(attendeeEmail);
+                attendeeDashboard(attendee, announcements, credentials);
 
-}
+            }
 
-void viewSessionsByAttendee(const string& email) {
-    // 1. Load attendee's tickets
-    vector<Ticket> tickets;
-    loadTickets(tickets);
+        } else if (choice == "2")  {
+            string exhibitorEmail = login("Exhibitor");
+            if(exhibitorEmail != "") {
+                Exhibitor exhibitor = findExhibitor(exhibitorEmail);
+                exhibitorDashboard(exhibitor, announcements, credentials);
 
-    // 2. Load venues 
-    vector<Venue> venues;
-    loadVenues(venues);  // 
+            }
 
-    // 3. Collect all venueIDs that the attendee joined (via eventName in tickets)
-    set<string> joinedVenueIDs;
-    for (const auto& t : tickets) {
-        if (t.userEmail == email) {
-            for (const auto& v : venues) {
-                if (v.eventName == t.eventName) {
-                    joinedVenueIDs.insert(v.venueID);
-                }
+        } else if (choice == "3") {
+            string adminEmail = login("Admin");
+            if(adminEmail != "") {
+                Admin admin = findAdmin(adminEmail);
+                adminDashboard(admin, announcements, credentials);
             }
-        }
-    }
 
-    if (joinedVenueIDs.empty()) {
-        cout << "You have not joined any events yet.\n";
-        return;
+        }else if (choice == "4") signUp(credentials);
+        else if (choice == "0") {
+            cout << "============================================================\n";
+            cout << "||     Exiting... Thank you for using the system!         ||\n";
+            cout << "============================================================\n";
+            break;
+        }
+        else {
+            cout << "============================================================\n";
+            cout << "||          Invalid Choice, please try again!             ||\n";
+            cout << "============================================================\n";
+        }
     }
+}
 
-    // 4. Load sessions
-    vector<Session> sessions;
-    loadSessions(sessions);
-
-    // 5. Display only sessions matching the attendee's joined venues
-    cout << "Sessions available for events you joined:\n";
-    bool found = false;
-    for (const auto& s : sessions) {
-        if (joinedVenueIDs.find(s.venueID) != joinedVenueIDs.end()) {
-            cout << "[" << s.sessionID << "] "
-                 << s.topic << " (Venue " << s.venueID
-                 << ", Time: " << s.timeSlot << ")\n";
-            found = true;
+// ==========================
+// BATCH MODE
+// ==========================
+// --batch <file> (or - for stdin) runs one command per line against the same
+// functions the menus use, without prompts. Arguments are separated by
+// spaces; quote an argument that contains spaces. Blank lines and lines
+// starting with # are skipped. Each command prints one JSON object per line,
+// then a summary line.
+//
+//   create-event <venue> "<event name>" <rows> <cols> <booth price> <type>:<price>:<capacity> ...
+//   purchase <email> <venue> "<ticket type>" <qty>
+//   refund <email> <ticket ID>
+//   book-booth <email> <venue> <booth ID>
+//   refund-booth <email> <venue> <booth ID>
+//   schedule-session <email> <venue> <HH:MM-HH:MM> "<topic>"
+//   close-event <venue>
+//   report <venue> | report all
+
+// Returns false on an unterminated quote
+bool splitCommandLine(const string& line, vector<string>& args) {
+    args.clear();
+    size_t i = 0;
+    while (i < line.size()) {
+        if (isspace((unsigned char)line[i])) {
+            i++;
+            continue;
+        }
+        string arg;
+        if (line[i] == '"') {
+            size_t close = line.find('"', i + 1);
+            if (close == string::npos) return false;
+            arg = line.substr(i + 1, close - i - 1);
+            i = close + 1;
+        } else {
+            while (i < line.size() && !isspace((unsigned char)line[i])) arg += line[i++];
         }
+        args.push_back(arg);
     }
+    return true;
+}
 
-    if (!found) {
-        cout << "No sessions scheduled yet for the events you joined.\n";
+string jsonString(string_view text) {
+    string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((unsigned char)c < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += c;
+        }
     }
+    return out + "\"";
+}
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+bool parseIntArg(const string& text, int& value) {
+    auto result = from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == errc() && result.ptr == text.data() + text.size();
+}
 
+bool parseDoubleArg(const string& text, double& value) {
+    try {
+        size_t used = 0;
+        value = stod(text, &used);
+        return used == text.size();
+    } catch (...) {
+        return false;
+    }
 }
 
-void updateSession(const string& email) {
-    vector<Session> sessions;
-    loadSessions(sessions);
+string formatAmount(double amount) {
+    stringstream ss;
+    ss << fixed << setprecision(2) << amount;
+    return ss.str();
+}
 
-    // Show exhibitor's sessions
-    vector<int> ownedIndexes;
-    cout << "Your Scheduled Sessions:\n";
-    for (int i = 0; i < sessions.size(); i++) {
-        if (sessions[i].exhibitorEmail == email) {
-            cout << i+1 << ". [" << sessions[i].sessionID << "] "
-                 << sessions[i].topic << " at Venue " << sessions[i].venueID
-                 << " (" << sessions[i].timeSlot << ")\n";
-            ownedIndexes.push_back(i);
+// Runs one parsed command. On success fields holds extra JSON members
+// (",\"key\":value..."); on failure error says why.
+bool runBatchCommand(const vector<string>& args, string& fields, string& error) {
+    const string& command = args[0];
+    vector<Venue>& venues = storeVenues();
+    auto expectArgs = [&](size_t count, const string& usage) {
+        if (args.size() == count + 1) return true;
+        error = "usage: " + command + " " + usage;
+        return false;
+    };
+    auto findVenue = [&](const string& venueID, bool needEvent, size_t& index) {
+        index = findVenueIndex(venues, venueID);
+        if (index >= venues.size()) error = "unknown venue " + venueID;
+        else if (needEvent && venues[index].isAvailable) error = "venue " + venueID + " has no event";
+        else return true;
+        return false;
+    };
+    size_t vi;
+
+    if (command == "create-event") {
+        if (args.size() < 7) {
+            error = "usage: create-event <venue> <event name> <rows> <cols> <booth price> <type>:<price>:<capacity> ...";
+            return false;
+        }
+        if (!findVenue(args[1], false, vi)) return false;
+        int rows, cols;
+        double boothPrice;
+        if (!parseIntArg(args[3], rows) || !parseIntArg(args[4], cols) || !parseDoubleArg(args[5], boothPrice)) {
+            error = "rows, columns and booth price must be numbers";
+            return false;
+        }
+        vector<TicketType> types;
+        for (size_t i = 6; i < args.size(); ++i) {
+            size_t p1 = args[i].find(':'), p2 = args[i].rfind(':');
+            TicketType t{args[i].substr(0, p1), 0, 0, 0};
+            if (p1 == string::npos || p1 == p2 || !parseDoubleArg(args[i].substr(p1 + 1, p2 - p1 - 1), t.price) ||
+                !parseIntArg(args[i].substr(p2 + 1), t.capacity)) {
+                error = "ticket types are written <type>:<price>:<capacity>";
+                return false;
+            }
+            types.push_back(t);
+        }
+        if (!createEvent(vi, args[2], rows, cols, boothPrice, types, error)) return false;
+        fields = ",\"venue\":" + jsonString(args[1]) + ",\"event\":" + jsonString(args[2]);
+        return true;
+    }
+
+    if (command == "purchase") {
+        if (!expectArgs(4, "<email> <venue> <ticket type> <qty>") || !findVenue(args[2], true, vi)) return false;
+        const vector<TicketType>& types = venues[vi].ticketType;
+        size_t ti = 0;
+        while (ti < types.size() && types[ti].type != args[3]) ti++;
+        int qty, firstID;
+        if (ti == types.size()) error = "unknown ticket type " + args[3];
+        else if (!parseIntArg(args[4], qty) || qty < 1) error = "quantity must be a positive number";
+        else if (!purchaseTickets(vi, ti, args[1], qty, &firstID)) error = "not enough tickets left";
+        else {
+            fields = ",\"tickets\":" + to_string(qty) + ",\"first\":" + jsonString(formatId('T', firstID)) +
+                     ",\"last\":" + jsonString(formatId('T', firstID + qty - 1)) + ",\"amount\":" + formatAmount(qty * types[ti].price);
+            return true;
         }
+        return false;
     }
 
-    if (ownedIndexes.empty()) {
-        cout << "You have no sessions to update.\n";
-        return;
+    if (command == "refund") {
+        if (!expectArgs(2, "<email> <ticket ID>")) return false;
+        double amount = 0;
+        if (!refundTicketByID(args[1], args[2], amount)) {
+            error = "ticket not found for this attendee";
+            return false;
+        }
+        fields = ",\"ticket\":" + jsonString(args[2]) + ",\"amount\":" + formatAmount(amount);
+        return true;
     }
 
-    int choice = getValidatedChoice(0, ownedIndexes.size(), "Enter the number of the session you want to update (0 to cancel): ");
-    if (choice == 0) {
-        cout << "Update cancelled.\n";
-        return;
+    if (command == "book-booth") {
+        if (!expectArgs(3, "<email> <venue> <booth ID>") || !findVenue(args[2], true, vi)) return false;
+        string boothID = canonicalBoothID(args[3]);
+        if (!isValidBoothID(venues[vi], boothID)) error = "invalid booth ID " + args[3];
+        else if (!rentBooth(vi, boothID, args[1])) error = "booth already booked";
+        else {
+            BoothType* bt = findBoothType(venues[vi], boothID);
+            fields = ",\"booth\":" + jsonString(boothID) + ",\"amount\":" + formatAmount(bt ? bt->price : 0.0);
+            return true;
+        }
+        return false;
     }
 
-    int idx = ownedIndexes[choice - 1];
-
-    cout << "Enter new topic (leave empty to keep current): ";
-    string newTopic;
-    getline(cin, newTopic);
-    if (!newTopic.empty()) sessions[idx].topic = newTopic;
-
-    // Validate new time slot
-    string newSlot;
-    while (true) {
-        cout << "Enter new time slot (HH:MM-HH:MM, leave empty to keep current): ";
-        getline(cin, newSlot);
-
-        if (newSlot.empty()) break;
+    if (command == "refund-booth") {
+        if (!expectArgs(3, "<email> <venue> <booth ID>")) return false;
+        string boothID = canonicalBoothID(args[3]);
+        double amount = 0;
+        if (!refundBoothByID(args[1], args[2], boothID, amount)) {
+            error = "booth not rented by this exhibitor";
+            return false;
+        }
+        fields = ",\"booth\":" + jsonString(boothID) + ",\"amount\":" + formatAmount(amount);
+        return true;
+    }
 
-        if (!isValidTimeSlot(newSlot)) {
-            cout << "Invalid time format. Example: 09:00-10:30\n";
-            continue;
+    if (command == "schedule-session") {
+        if (!expectArgs(4, "<email> <venue> <HH:MM-HH:MM> <topic>") || !findVenue(args[2], true, vi)) return false;
+        Session s;
+        s.exhibitorEmail = args[1];
+        s.venueID = args[2];
+        s.timeSlot = args[3];
+        s.topic = args[4];
+        int start, end;
+        if (!hasBoothInVenue(s.exhibitorEmail, s.venueID)) error = "exhibitor has no booth in this venue";
+        else if (hasSessionInVenue(s.exhibitorEmail, s.venueID)) error = "exhibitor already has a session in this venue";
+        else if (!isValidTimeSlot(s.timeSlot)) error = "invalid time slot " + s.timeSlot;
+        else if (parseTimeSlot(s.timeSlot, start, end) && sessionSlotClashes(s.venueID, start, end)) error = "time slot clashes with another session";
+        else if (!addSession(s)) error = "session topic cannot be empty";
+        else {
+            fields = ",\"session\":" + jsonString(s.sessionID);
+            return true;
         }
+        return false;
+    }
 
-        // Check clash with other sessions
-        bool clash = false;
-        for (int j = 0; j < sessions.size(); j++) {
-            if (j != idx && sessions[j].venueID == sessions[idx].venueID &&
-                isOverlap(sessions[j].timeSlot, newSlot)) {
-                clash = true;
-                break;
+    if (command == "close-event") {
+        if (!expectArgs(1, "<venue>") || !findVenue(args[1], true, vi)) return false;
+        string eventName = venues[vi].eventName;
+        closeEvent(args[1], venues);
+        fields = ",\"event\":" + jsonString(eventName);
+        return true;
+    }
+
+    if (command == "report") {
+        if (!expectArgs(1, "<venue>|all")) return false;
+        const vector<Session>& sessions = storeSessions();
+        size_t written = 0;
+        for (size_t i = 0; i < venues.size(); ++i) {
+            if (venues[i].eventName.empty() || (args[1] != "all" && venues[i].venueID != args[1])) continue;
+            vector<const Session*> venueSessions;
+            Symbol venue = Symbol::existing(venues[i].venueID);
+            for (const auto& s : sessions) {
+                if (s.venueID == venue) venueSessions.push_back(&s);
             }
+            if (!writeReportFile(venues[i], venueSessions)) {
+                error = "unable to write " + reportFilename(venues[i]);
+                return false;
+            }
+            written++;
         }
-
-        if (clash) {
-            cout << "Time slot overlaps with another session. Please try again.\n";
-            continue;
+        if (written == 0) {
+            error = "no event found for " + args[1];
+            return false;
         }
-
-        sessions[idx].timeSlot = newSlot;
-        break;
+        fields = ",\"reports\":" + to_string(written);
+        return true;
     }
 
-    saveSessions(sessions);
-    cout << "Session updated successfully.\n";
+    error = "unknown command";
+    return false;
 }
 
-void deleteSession(const string& email) {
-    vector<Session> sessions;
-    loadSessions(sessions);
-
-    // Show exhibitor's sessions
-    vector<int> ownedIndexes;
-    cout << "Your Scheduled Sessions:\n";
-    for (int i = 0; i < sessions.size(); i++) {
-        if (sessions[i].exhibitorEmail == email) {
-            cout << i+1 << ". [" << sessions[i].sessionID << "] "
-                 << sessions[i].topic<< " at Venue " << sessions[i].venueID
-                 << " (" << sessions[i].timeSlot << ")\n";
-            ownedIndexes.push_back(i);
+int runBatch(const string& filename) {
+    ifstream file;
+    if (filename != "-") {
+        file.open(filename);
+        if (!file.is_open()) {
+            cerr << "Could not open " << filename << "\n";
+            return 1;
         }
     }
+    istream& in = (filename == "-") ? cin : file;
 
-    if (ownedIndexes.empty()) {
-        cout << "You have no sessions to delete.\n";
-        return;
-    }
+    // stdout carries only the JSON lines; the menus' messages are dropped
+    ostream out(cout.rdbuf());
+    NullBuffer sink;
+    cout.rdbuf(&sink);
 
-    int choice = getValidatedChoice(0, ownedIndexes.size(), "Enter the number of the session you want to delete (0 to cancel): ");
-    if (choice == 0) {
-        cout << "Deletion cancelled.\n";
-        return;
-    }
+    recoverStores();
+    recoverIdCounters();
+    startBackgroundCommits();
+    uint64_t commitsBefore = walCommits;
 
-    int idx = ownedIndexes[choice - 1];
-    cout << "Are you sure you want to delete session [" << sessions[idx].sessionID << "] (Y/N)? ";
-    char confirm;
-    cin >> confirm;
-    cin.ignore();
+    auto start = chrono::steady_clock::now();
+    size_t lineNumber = 0, succeeded = 0, failed = 0;
+    string line;
+    vector<string> args;
+    while (getline(in, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        size_t first = line.find_first_not_of(" \t");
+        if (first == string::npos || line[first] == '#') continue;
+
+        string fields, error;
+        bool ok = false;
+        if (!splitCommandLine(line, args)) error = "unterminated quote";
+        else ok = runBatchCommand(args, fields, error);
+
+        out << "{\"line\":" << lineNumber << ",\"command\":" << jsonString(args.empty() ? "" : args[0])
+            << ",\"ok\":" << (ok ? "true" : "false");
+        if (ok) out << fields;
+        else out << ",\"error\":" << jsonString(error);
+        out << "}\n";
+        (ok ? succeeded : failed)++;
+    }
+
+    stopBackgroundCommits();
+    flushStore();
+    releaseIdLeases();
+    cout.rdbuf(out.rdbuf());
+
+    out << "{\"summary\":{\"commands\":" << succeeded + failed << ",\"ok\":" << succeeded
+        << ",\"failed\":" << failed << ",\"commits\":" << walCommits - commitsBefore << ",\"ms\":" << fixed << setprecision(1)
+        << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() << "}}\n";
+    return failed ? 1 : 0;
+}
 
-    if (confirm == 'y' || confirm == 'Y') {
-        sessions.erase(sessions.begin() + idx);
-        saveSessions(sessions);
-        cout << "Session deleted successfully.\n";
+// ==========================
+// SERVER MODE
+// ==========================
+// --serve [socket] owns the data files and serves kiosks and staff
+// terminals over a Unix domain socket (default expo.sock). Requests and
+// responses are single lines: a request uses the batch command syntax, a
+// response is one JSON object. A connection logs in first and then acts as
+// that account:
+//
+//   login <Attendee|Exhibitor|Admin> <email> <password>    logout    quit
+//   Attendee:  purchase <venue> "<ticket type>" <qty>    refund <ticket ID>    tickets
+//   Exhibitor: book-booth <venue> <booth ID>    refund-booth <venue> <booth ID>
+//              schedule-session <venue> <HH:MM-HH:MM> "<topic>"
+//   Anyone:    sessions <venue>
+//   Admin:     any batch command, with emails given explicitly
+//
+// Purchases, booth rentals, logins and session lists run concurrently under
+// a shared storeMutex (see DATA STORE); every other command runs alone.
+
+// Commands a role may send without its email; the server inserts it
+bool roleCommand(const string& role, const string& command) {
+    if (role == "Attendee") return command == "purchase" || command == "refund";
+    if (role == "Exhibitor") return command == "book-booth" || command == "refund-booth" || command == "schedule-session";
+    return false;
+}
+
+// Other copies of the program cannot write while this one holds the store
+// files, so whatever they changed is reloaded once, before the command takes
+// its own lock. Call with the store files locked and storeMutex not held.
+void catchUpWithOtherCopies() {
+    if (!anyCollectionStale()) return;
+    unique_lock<shared_mutex> lock(storeMutex);
+    settleTicketInventory();
+    syncLoadedCollections();
+}
+
+// Runs a logged-in command under the store lock it needs
+string serveLockedRequest(vector<string>& args, const string& role, const string& email) {
+    string command = args[0];
+    auto failure = [](const string& error) { return "{\"ok\":false,\"error\":" + jsonString(error) + "}"; };
+    bool concurrent = command == "purchase" || command == "book-booth" || command == "sessions";
+
+    StoreFileLock storeFiles;
+    catchUpWithOtherCopies();
+    shared_lock<shared_mutex> shared(storeMutex, defer_lock);
+    unique_lock<shared_mutex> exclusive(storeMutex, defer_lock);
+    if (concurrent) {
+        shared.lock();
     } else {
-        cout << "Deletion cancelled.\n";
+        exclusive.lock();
+        settleTicketInventory();
     }
-}
 
-void ExhibitorSessionSelection(const string& email) {
-    cout << "===========================================\n";
-    cout << "||              Session Menu             ||\n";
-    cout << "===========================================\n";
-    cout << "|| 1. View All Session Scheduled         ||\n";
-    cout << "|| 2. Update Session Detail              ||\n";
-    cout << "|| 3. Delete Session                     ||\n";
-    cout << "|| 0. Back                               ||\n";
-    cout << "===========================================\n";
+    if (command == "tickets" && role == "Attendee") {
+        const vector<Ticket>& tickets = storeTickets();
+        string list;
+        for (size_t pos : userTicketPositions(email)) {
+            const Ticket& t = tickets[pos];
+            list += string(list.empty() ? "" : ",") + "{\"id\":" + jsonString(t.ticketID) + ",\"event\":" +
+                    jsonString(t.eventName.str()) + ",\"type\":" + jsonString(t.ticketType.str()) + ",\"amount\":" + formatAmount(t.amount) + "}";
+        }
+        return "{\"ok\":true,\"tickets\":[" + list + "]}";
+    }
+    if (command == "sessions") {
+        if (args.size() != 2) return failure("usage: sessions <venue>");
+        string list;
+        Symbol venue = Symbol::existing(args[1]);
+        for (const auto& s : storeSessions()) {
+            if (s.venueID != venue) continue;
+            list += string(list.empty() ? "" : ",") + "{\"id\":" + jsonString(s.sessionID) + ",\"topic\":" +
+                    jsonString(s.topic) + ",\"slot\":" + jsonString(s.timeSlot) + ",\"exhibitor\":" + jsonString(s.exhibitorEmail.str()) + "}";
+        }
+        return "{\"ok\":true,\"sessions\":[" + list + "]}";
+    }
 
-    int choice = getValidatedChoice(0, 3, "Choice: ");
+    if (roleCommand(role, command)) {
+        args.insert(args.begin() + 1, email);
+    } else if (role != "Admin") {
+        return failure(command + " is not available to " + role + " accounts");
+    }
+    string fields, error;
+    if (!runBatchCommand(args, fields, error)) return failure(error);
+    return "{\"ok\":true" + fields + "}";
+}
 
-    switch (choice)
-    {
-        case 1: viewSessionsByExhibitor(email); break;
-        case 2: updateSession(email); break;
-        case 3: deleteSession(email); break;
-        case 0: return;
+// Handles one request line for a connection. role and email hold the login.
+string serveRequest(const string& line, string& role, string& email, bool& quit) {
+    vector<string> args;
+    if (!splitCommandLine(line, args)) return "{\"ok\":false,\"error\":\"unterminated quote\"}";
+    if (args.empty()) return "{\"ok\":false,\"error\":\"empty request\"}";
+    const string& command = args[0];
+    auto failure = [](const string& error) { return "{\"ok\":false,\"error\":" + jsonString(error) + "}"; };
+
+    if (command == "quit") {
+        quit = true;
+        return "{\"ok\":true}";
+    }
+    if (command == "login") {
+        if (args.size() != 4) return failure("usage: login <role> <email> <password>");
+        StoreFileLock storeFiles;
+        catchUpWithOtherCopies();
+        shared_lock<shared_mutex> lock(storeMutex);
+        if (!checkCredentials(args[1], args[2], args[3])) return failure("invalid credentials");
+        role = args[1];
+        email = args[2];
+        return "{\"ok\":true,\"role\":" + jsonString(role) + "}";
+    }
+    if (command == "logout") {
+        role.clear();
+        email.clear();
+        return "{\"ok\":true}";
+    }
+    if (role.empty()) return failure("log in first");
+
+    string response = serveLockedRequest(args, role, email);
+    commitWal(); // replies only promise what is on disk
+    return response;
+}
+
+#ifndef _WIN32
+// Reads one '\n'-terminated line, keeping any bytes past it in pending
+bool readSocketLine(int fd, string& pending, string& line) {
+    while (true) {
+        size_t newline = pending.find('\n');
+        if (newline != string::npos) {
+            line = pending.substr(0, newline);
+            pending.erase(0, newline + 1);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            return true;
+        }
+        char chunk[4096];
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) return false;
+        pending.append(chunk, n);
     }
- 
 }
 
-// ==========================
-// MONITORING MODULE
-// ==========================
-void monitorExhibitorStats(const string& exhibitorEmail) {
+bool sendAll(int fd, const string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += n;
+    }
+    return true;
+}
 
-    vector<Booth> booths; loadBooths(booths);
-    vector<Session> sessions; loadSessions(sessions);
+bool socketAddress(const string& path, sockaddr_un& addr) {
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return false;
+    memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
 
-    cout << "\n========================================================\n";
-    cout << "||         Exhibitor Monitoring Dashboard             ||\n";
-    cout << "========================================================\n";
+atomic<bool> serverStopping(false);
+int serverListenFd = -1;
 
-    cout << "Exhibitor: " << exhibitorEmail;
+// shutdown() is async-signal-safe; it wakes the blocked accept()
+void stopServer(int) {
+    serverStopping = true;
+    if (serverListenFd >= 0) shutdown(serverListenFd, SHUT_RDWR);
+}
 
-    cout << "\n=============================\n";
-    cout << "||       Booth Stats       ||\n";
-    cout << "=============================\n";
+// Open client connections, so a stopping server can wake them
+mutex clientsMutex;
+condition_variable clientsDone;
+set<int> clientFds;
+
+void serveClient(int fd) {
+    string pending, line, role, email;
+    bool quit = false;
+    while (!quit && readSocketLine(fd, pending, line)) {
+        if (!sendAll(fd, serveRequest(line, role, email, quit) + "\n")) break;
+    }
+    lock_guard<mutex> lock(clientsMutex);
+    clientFds.erase(fd);
+    close(fd);
+    clientsDone.notify_all();
+}
 
-    bool boothFound = false;
-    for (const auto& booth : booths) {
-        if (booth.userEmail == exhibitorEmail) {
-            cout << "Venue: " << booth.venueID << endl
-                 << "Booth: " << booth.boothID << endl
-                 << "Amount Paid: RM" << fixed << setprecision(2) << booth.amount << endl
-                 << "Status: " << (booth.isRented ? "Rented" : "Refunded") << endl
-                 << endl;
-            boothFound = true;
+int runServer(const string& path, bool atomicTickets) {
+    sockaddr_un addr;
+    if (!socketAddress(path, addr)) {
+        cerr << "Socket path too long: " << path << "\n";
+        return 1;
+    }
+    serverListenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path.c_str()); // a socket file left behind by a killed server
+    if (serverListenFd < 0 || ::bind(serverListenFd, (sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(serverListenFd, 64) != 0) {
+        cerr << "Could not listen on " << path << ": " << strerror(errno) << "\n";
+        return 1;
+    }
+    signal(SIGINT, stopServer);
+    signal(SIGTERM, stopServer);
+
+    // Responses go to the clients; the menus' messages are dropped
+    NullBuffer sink;
+    streambuf* screen = cout.rdbuf(&sink);
+    recoverStores();
+    recoverIdCounters();
+    prepareConcurrentSales(atomicTickets);
+    commitMode = COMMIT_BEFORE_REPLY;
+    cerr << "Serving on " << path << (atomicTickets ? " with atomic ticket inventory" : "") << " (Ctrl+C to stop)\n";
+
+    while (!serverStopping) {
+        int fd = accept(serverListenFd, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            break;
         }
-    }
-    if (!boothFound) {
-        cout << "No booths booked yet.\n";
+        lock_guard<mutex> lock(clientsMutex);
+        clientFds.insert(fd);
+        thread(serveClient, fd).detach();
     }
 
-    cout << "==============================\n";
-    cout << "||    Scheduled Sessions    ||\n";
-    cout << "==============================\n";
+    // Wake every client still connected and wait for them, then write everything out
+    {
+        unique_lock<mutex> lock(clientsMutex);
+        for (int fd : clientFds) shutdown(fd, SHUT_RDWR);
+        clientsDone.wait(lock, [] { return clientFds.empty(); });
+    }
+    close(serverListenFd);
+    unlink(path.c_str());
+    endConcurrentSales();
+    commitMode = COMMIT_EACH_WRITE;
+    flushStore();
+    releaseIdLeases();
+    cout.rdbuf(screen);
+    cerr << "Server stopped.\n";
+    return 0;
+}
 
-    bool sessionFound = false;
-    for (const auto& session : sessions) {
-        if (session.exhibitorEmail == exhibitorEmail) {
-            cout << "Session ID: " << session.sessionID << endl
-                 << "Venue: " << session.venueID << endl
-                 << "Topic: " << session.topic << endl
-                 << "Time Slot: " << session.timeSlot << endl
-                 << endl;
-            sessionFound = true;
+// Stand-in kiosk: sends each line of the input to the server and prints
+// each response
+int runClient(const string& path, const string& inputFile) {
+    sockaddr_un addr;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (!socketAddress(path, addr) || fd < 0 || connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+        cerr << "Could not connect to " << path << "\n";
+        return 1;
+    }
+    ifstream file;
+    if (!inputFile.empty()) {
+        file.open(inputFile);
+        if (!file.is_open()) {
+            cerr << "Could not open " << inputFile << "\n";
+            return 1;
+        }
+    }
+    istream& in = inputFile.empty() ? cin : file;
+
+    string line, pending, response;
+    bool failed = false;
+    while (getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        if (!sendAll(fd, line + "\n") || !readSocketLine(fd, pending, response)) {
+            cerr << "Connection closed by server\n";
+            failed = true;
+            break;
         }
+        cout << response << "\n";
+        if (response.compare(0, 11, "{\"ok\":false") == 0) failed = true;
     }
-    if (!sessionFound) {
-        cout << "No sessions scheduled yet.\n";
-    }
-
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+    close(fd);
+    return failed ? 1 : 0;
+}
+#else
+int runServer(const string&, bool) {
+    cerr << "Server mode needs Unix domain sockets and is not available on Windows.\n";
+    return 1;
+}
 
+int runClient(const string&, const string&) {
+    cerr << "Server mode needs Unix domain sockets and is not available on Windows.\n";
+    return 1;
 }
+#endif
+
+// ==========================
+// DATASET GENERATOR
+// ==========================
+// Writes a consistent synthetic dataset in the same text formats the load*
+// functions read, for exercising load/save at production size. The same
+// seed and options always produce byte-identical files.
+struct GeneratorConfig {
+    string dir = "expo_data";
+    uint64_t seed = 1;
+    int venues = 20;
+    int rows = 10;
+    int columns = 10;
+    int ticketTypes = 3;
+    size_t tickets = 1000000;
+    int attendees = 50000;
+    int exhibitors = 2000;
+    int admins = 3;
+    double boothFill = 0.6;       // share of booths currently rented
+    double ticketRefunds = 0.05;  // share of tickets that were refunded
+    double boothRefunds = 0.1;    // share of booths with an earlier refunded rental
+    int sessionsPerVenue = 10;
+    size_t feedback = 100000;
+    int announcements = 20;
+};
+
+// splitmix64: the standard <random> distributions differ between library
+// versions, so the generator does its own arithmetic on a fixed sequence
+struct ExpoRandom {
+    uint64_t state;
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    uint64_t below(uint64_t n) { return n ? next() % n : 0; }
+    bool chance(double p) { return (next() >> 11) * (1.0 / 9007199254740992.0) < p; }
+};
 
-void monitorAdminStats() {
+// Buffers lines and writes them in large blocks
+class DatasetFile {
+public:
+    explicit DatasetFile(const string& path) : file(path, ios::binary | ios::trunc) {}
+    ~DatasetFile() { flush(); }
 
-    vector<Ticket> tickets; loadTickets(tickets);
-    vector<Booth> booths; loadBooths(booths);
-    vector<Session> sessions; loadSessions(sessions);
-    vector<Venue> venues; loadVenues(venues);
+    void add(const string& line) {
+        buffer += line;
+        buffer += '\n';
+        lines++;
+        if (buffer.size() >= (1 << 20)) flush();
+    }
+    size_t count() const { return lines; }
 
-    if (tickets.empty()) {
-        cout << "No ticket sales data available.\n";
-        return;
+private:
+    void flush() {
+        file.write(buffer.data(), buffer.size());
+        buffer.clear();
     }
 
-    cout << "\n==================================\n";
-    cout << "||     Monitor Venue Stat       ||\n";
-    cout << "==================================\n";
+    ofstream file;
+    string buffer;
+    size_t lines = 0;
+};
 
-    for (size_t i = 0; i < venues.size(); i++) {
-        cout << i + 1 << ". " << venues[i].venueID << " - " << venues[i].eventName << endl;
+// A, B, ... Z, AA, AB, ... like spreadsheet columns
+string generatedVenueID(int index) {
+    string id;
+    for (int n = index + 1; n > 0; n = (n - 1) / 26) {
+        id.insert(id.begin(), char('A' + (n - 1) % 26));
     }
+    return id;
+}
 
-    cout << endl;
+string generatedTicketTypeName(int index) {
+    const char* names[] = {"Normal", "Express", "VIP", "Student", "Family", "Senior"};
+    if (index < 6) return names[index];
+    return "Tier " + to_string(index + 1);
+}
 
-    int choice = getValidatedChoice(0, venues.size(), "Enter the number of the venue to view stats: ");
-    
-    if (choice == 0) {
-        cout << "Returning to dashboard.\n\n";
-        return;
+bool parseGeneratorOption(GeneratorConfig& config, const string& option) {
+    size_t eq = option.find('=');
+    if (eq == string::npos) {
+        config.dir = option;
+        return !option.empty();
+    }
+    string key = option.substr(0, eq);
+    string value = option.substr(eq + 1);
+    try {
+        if (key == "seed") config.seed = stoull(value);
+        else if (key == "venues") config.venues = stoi(value);
+        else if (key == "grid") {
+            size_t x = value.find('x');
+            if (x == string::npos) return false;
+            config.rows = stoi(value.substr(0, x));
+            config.columns = stoi(value.substr(x + 1));
+        }
+        else if (key == "types") config.ticketTypes = stoi(value);
+        else if (key == "tickets") config.tickets = stoull(value);
+        else if (key == "attendees") config.attendees = stoi(value);
+        else if (key == "exhibitors") config.exhibitors = stoi(value);
+        else if (key == "admins") config.admins = stoi(value);
+        else if (key == "booth-fill") config.boothFill = stod(value);
+        else if (key == "ticket-refunds") config.ticketRefunds = stod(value);
+        else if (key == "booth-refunds") config.boothRefunds = stod(value);
+        else if (key == "sessions") config.sessionsPerVenue = stoi(value);
+        else if (key == "feedback") config.feedback = stoull(value);
+        else if (key == "announcements") config.announcements = stoi(value);
+        else return false;
+    } catch (...) {
+        return false;
     }
+    return true;
+}
 
-    Venue selectedVenue = venues[choice - 1];
-
-    cout << "\nMonitoring: Venue " << selectedVenue.venueID << " - " << selectedVenue.eventName << endl;
+bool validGeneratorConfig(const GeneratorConfig& c) {
+    return c.venues >= 1 && c.venues <= 65535 && c.rows >= 1 && c.rows <= MAX_BOOTH_ROWS &&
+           c.columns >= 1 && c.columns <= MAX_BOOTH_COLS &&
+           c.ticketTypes >= 1 && c.ticketTypes <= MAX_TICKET_TYPES &&
+           c.attendees >= 1 && c.exhibitors >= 1 && c.admins >= 0 &&
+           c.sessionsPerVenue >= 0 && c.announcements >= 0;
+}
 
-    // ticket sales
-    int ticketCount = 0;
-    double ticketRevenue = 0.0;
+void generateDataset(const GeneratorConfig& config) {
+    ExpoRandom rng{config.seed};
+    filesystem::create_directories(config.dir);
+    auto path = [&](const string& name) { return (filesystem::path(config.dir) / name).string(); };
 
-    for (const auto& ticket : tickets) {
-        if (ticket.eventName == selectedVenue.eventName) {
-            ticketCount++;
-            ticketRevenue += ticket.amount;
+    // Users
+    vector<string> attendeeEmails, exhibitorEmails;
+    {
+        DatasetFile file(path("attendees.txt"));
+        for (int i = 1; i <= config.attendees; ++i) {
+            Attendee a{formatId('A', i), "Attendee " + to_string(i), "attendee" + to_string(i) + "@example.com",
+                       "pass" + to_string(rng.below(1000000))};
+            attendeeEmails.push_back(a.email);
+            file.add(attendeeLine(a));
+        }
+    }
+    {
+        DatasetFile file(path("exhibitors.txt"));
+        for (int i = 1; i <= config.exhibitors; ++i) {
+            Exhibitor e{formatId('E', i), "Company " + to_string(i), "exhibitor" + to_string(i) + "@example.com",
+                        "pass" + to_string(rng.below(1000000))};
+            exhibitorEmails.push_back(e.email);
+            file.add(exhibitorLine(e));
+        }
+    }
+    {
+        DatasetFile file(path("admins.txt"));
+        for (int i = 1; i <= config.admins; ++i) {
+            file.add(adminLine({"admin" + to_string(i) + "@example.com", "admin" + to_string(i)}));
         }
     }
-    cout << "==========================================\n";
-    cout << "||         Ticket Sales Summary         ||\n";
-    cout << "==========================================\n";
-    cout << "Total Tickets Sold: " << ticketCount << endl;
-    cout << "Total Ticket Revenue: RM " << fixed << setprecision(2) << ticketRevenue << endl;
 
-    // booth sales
-    int boothCount = 0;
-    double boothRevenue = 0.0;
-    
-    for (const auto& booth : booths) {
-        if (booth.venueID == selectedVenue.venueID && booth.isRented) {
-            boothCount++;
-            boothRevenue += booth.amount;
+    // Venues: every venue hosts an event with a unique name, since tickets
+    // refer to their venue by event name
+    vector<Venue> venues;
+    for (int i = 0; i < config.venues; ++i) {
+        Venue v;
+        v.venueID = generatedVenueID(i);
+        v.eventName = "Expo Event " + to_string(i + 1);
+        v.rows = config.rows;
+        v.columns = config.columns;
+        v.isAvailable = false;
+        double basePrice = 5 + rng.below(20);
+        for (int t = 0; t < config.ticketTypes; ++t) {
+            v.ticketType.push_back({generatedTicketTypeName(t), basePrice * (t + 1) + (rng.below(2) ? 0.5 : 0), 0, 0});
+        }
+        double boothPrice = 20 + rng.below(60) + 0.5;
+        for (int r = 0; r < v.rows; ++r) {
+            for (int c = 0; c < v.columns; ++c) {
+                v.boothType.push_back({string(1, 'A' + c) + to_string(r + 1), boothPrice, false});
+            }
         }
+        venues.push_back(v);
     }
-    cout << "==========================================\n";
-    cout << "||          Booth Sales Summary         ||\n";
-    cout << "==========================================\n";
-    cout << "Total Booths Rented: " << boothCount << endl;
-    cout << "Total Booth Revenue: RM " << fixed << setprecision(2) << boothRevenue << endl;
-    displayBoothLayout(selectedVenue);
 
-    // sessions scheduled
-    cout << "==========================================\n";
-    cout << "||           Sessions Summary           ||\n";
-    cout << "==========================================\n";
-    bool foundSession = false;
-    for (const auto& session : sessions) {
-        if (session.venueID == selectedVenue.venueID) {
-            cout << "[" << session.sessionID << "] " << session.topic << " at " << session.timeSlot << " (Exhibitor: " << session.exhibitorEmail << ")\n";
-            foundSession = true;
+    // Tickets get sequential IDs in purchase order; a refunded ticket moves
+    // to the refund log and no longer counts as sold
+    struct LiveTicket { uint32_t attendee; uint16_t venue; };
+    vector<LiveTicket> live;
+    live.reserve(config.tickets);
+    {
+        DatasetFile ticketFile(path("ticket.txt"));
+        DatasetFile refundFile(path("Ticketrefunds.txt"));
+        for (size_t i = 0; i < config.tickets; ++i) {
+            size_t vi = rng.below(venues.size());
+            size_t ti = rng.below(venues[vi].ticketType.size());
+            uint32_t attendee = rng.below(attendeeEmails.size());
+            TicketType& tt = venues[vi].ticketType[ti];
+            Ticket t{attendeeEmails[attendee], formatId('T', i + 1), venues[vi].eventName, tt.type, tt.price};
+            if (rng.chance(config.ticketRefunds)) {
+                refundFile.add(ticketLine(t) + ",REFUNDED");
+            } else {
+                ticketFile.add(ticketLine(t));
+                tt.sold++;
+                live.push_back({attendee, (uint16_t)vi});
+            }
         }
     }
-    if (!foundSession) {
-        cout << " - No sessions scheduled yet.\n";
+    // Capacity leaves some headroom so the dataset can still take purchases
+    for (auto& v : venues) {
+        for (auto& tt : v.ticketType) tt.capacity = tt.sold + 10 + rng.below(tt.sold / 4 + 1);
     }
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
-
-}
-
-// ==========================
-// REPORTING MODULE
-// ==========================
-void generateEventReport(const string& venueID, const vector<Ticket>& tickets, const vector<Booth>& booths, const vector<Session>& sessions, const vector<Venue>& venues) {
-    
-    // Find venue
-    auto it = find_if(venues.begin(), venues.end(),
-        [&](const Venue& v) { return v.venueID == venueID; });
-
-    if (it == venues.end() || it->eventName.empty()) {
-        cout << "[ERROR] Venue not found or no event assigned.\n";
-        return;
+    // Booths: a refunded rental is written before the current one, as the
+    // refund flow leaves it in booth.txt with the rented flag cleared
+    vector<vector<size_t>> venueExhibitors(venues.size());
+    {
+        DatasetFile boothFile(path("booth.txt"));
+        DatasetFile refundFile(path("boothRefunds.txt"));
+        for (size_t vi = 0; vi < venues.size(); ++vi) {
+            Venue& v = venues[vi];
+            for (auto& bt : v.boothType) {
+                if (rng.chance(config.boothRefunds)) {
+                    Booth old{exhibitorEmails[rng.below(exhibitorEmails.size())], v.venueID, bt.boothID, bt.price, false};
+                    boothFile.add(boothLine(old));
+                    stringstream refundLine;
+                    refundLine << old.userEmail << "," << old.boothID << "," << old.venueID << "," << old.amount << ",REFUNDED";
+                    refundFile.add(refundLine.str());
+                }
+                if (rng.chance(config.boothFill)) {
+                    size_t exhibitor = rng.below(exhibitorEmails.size());
+                    boothFile.add(boothLine({exhibitorEmails[exhibitor], v.venueID, bt.boothID, bt.price, true}));
+                    bt.isRented = true;
+                    venueExhibitors[vi].push_back(exhibitor);
+                }
+            }
+        }
     }
 
-    const Venue& venue = *it;
-    cout << "\n=========================================\n";
-    cout << "FINAL REPORT FOR EVENT: " << venue.eventName << "\n";
-    cout << "Venue ID: " << venue.venueID << "\n";
-    cout << "=========================================\n";
+    {
+        DatasetFile file(path("venue.txt"));
+        for (const auto& v : venues) file.add(venueLine(v));
+    }
 
-    // --- Ticket Summary ---
-    int totalTickets = 0;
-    double totalTicketRevenue = 0.0;
-    for (const auto& t : tickets) {
-        if (t.eventName == venue.eventName) { // only this event
-            totalTickets++;
-            totalTicketRevenue += t.amount;
+    // Sessions: held by exhibitors renting a booth in the venue, in
+    // back-to-back slots between 08:00 and 22:00 so none of them clash
+    {
+        DatasetFile file(path("sessions.txt"));
+        int sessionID = 1;
+        for (size_t vi = 0; vi < venues.size(); ++vi) {
+            if (venueExhibitors[vi].empty()) continue;
+            int start = 8 * 60;
+            for (int n = 0; n < config.sessionsPerVenue; ++n) {
+                int end = start + 30 * (1 + rng.below(4));
+                if (end > 22 * 60) break;
+                size_t exhibitor = venueExhibitors[vi][rng.below(venueExhibitors[vi].size())];
+                Session s{formatId('S', sessionID++), venues[vi].venueID, exhibitorEmails[exhibitor],
+                          "Topic " + to_string(n + 1), minutesToTime(start) + "-" + minutesToTime(end)};
+                file.add(sessionLine(s));
+                start = end + 30 * rng.below(2);
+            }
         }
     }
-    cout << "Ticket Sales Summary\n";
-    cout << "Total Tickets Sold : " << totalTickets << endl;
-    cout << "Total Ticket Revenue: RM " << fixed << setprecision(2) << totalTicketRevenue << "\n";
 
-    // --- Booth Summary ---
-    int totalBooths = 0;
-    double totalBoothRevenue = 0.0;
-    for (const auto& b : booths) {
-        if (b.venueID == venue.venueID && b.isRented) {
-            totalBooths++;
-            totalBoothRevenue += b.amount;
+    // Feedback comes from attendees holding a ticket for the event
+    {
+        DatasetFile file(path("feedback.txt"));
+        for (size_t i = 0; i < config.feedback && !live.empty(); ++i) {
+            const LiveTicket& t = live[rng.below(live.size())];
+            file.add(feedbackLine({attendeeEmails[t.attendee], venues[t.venue].eventName,
+                                   (int)rng.below(5) + 1, "Comment " + to_string(i + 1)}));
         }
     }
-    cout << "\nBooth Rental Summary\n";
-    cout << "Total Booths Rented : " << totalBooths << endl;
-    cout << "Total Booth Revenue : RM " << fixed << setprecision(2) << totalBoothRevenue << "\n";
 
-    // --- Session Summary ---
-    cout << "\nSessions Summary\n";
-    bool hasSessions = false;
-    for (const auto& s : sessions) {
-        if (s.venueID == venue.venueID) {
-            cout << "   - [" << s.sessionID << "] "
-                 << s.topic << " | Time: " << s.timeSlot
-                 << " | Exhibitor: " << s.exhibitorEmail << "\n";
-            hasSessions = true;
+    {
+        DatasetFile file(path("announcements.txt"));
+        const char* audiences[] = {"Both", "Exhibitor", "Attendee"};
+        for (int i = 1; i <= config.announcements; ++i) {
+            file.add(announcementLine({i, audiences[rng.below(3)], "Announcement " + to_string(i),
+                                       "Generated announcement " + to_string(i)}));
         }
     }
-    if (!hasSessions) cout << "   No sessions scheduled.\n";
 
-    // --- Grand Total ---
-    double grandTotal = totalTicketRevenue + totalBoothRevenue;
-    cout << "\nGRAND TOTAL REVENUE: RM " << fixed << setprecision(2) << grandTotal << endl;
-    cout << "=========================================\n";
-    cout << "         END OF FINAL REPORT              \n";
-    cout << "=========================================\n";
+    size_t sold = live.size();
+    cout << "Wrote " << config.venues << " venues, " << sold << " tickets ("
+         << config.tickets - sold << " refunded), " << config.attendees << " attendees and "
+         << config.exhibitors << " exhibitors to " << config.dir << "/ (seed " << config.seed << ")\n";
+}
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+// ==========================
+// BENCHMARKS
+// ==========================
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
 
+void writeBenchTicketFile(const string& filename, size_t rows) {
+    const char* types[] = {"Normal", "Express", "VIP"};
+    const double prices[] = {10, 20, 55.5};
+
+    string buffer;
+    buffer.reserve(rows * 56);
+    for (size_t i = 0; i < rows; ++i) {
+        size_t type = i % 3;
+        buffer += "user" + to_string(i % 50000) + "@example.com,T" + to_string(i + 1) +
+                  ",Bench Event " + to_string(i % 8) + "," + types[type] + ",";
+        stringstream amount;
+        amount << prices[type];
+        buffer += amount.str() + "\n";
+    }
+    ofstream file(filename, ios::binary | ios::trunc);
+    file << buffer;
 }
 
-void exportReportToFile(const string& venueID, const vector<Ticket>& tickets, const vector<Booth>& booths, const vector<Session>& sessions, const vector<Venue>& venues) {
-    
-    auto it = find_if(venues.begin(), venues.end(),
-        [&](const Venue& v) { return v.venueID == venueID; });
+void benchTicketLoaders(size_t rows) {
+    const string filename = "bench_ticket.txt";
+    cout << "Writing " << rows << " ticket rows to " << filename << "...\n";
+    writeBenchTicketFile(filename, rows);
+
+    // Touch the file once so every run reads from the page cache
+    { MappedFile warm(filename); volatile size_t n = count(warm.data().begin(), warm.data().end(), '\n'); (void)n; }
+
+    const int runs = 3;
+    double streamMs = 1e300, viewMs = 1e300, materializeMs = 1e300;
+    size_t loaded = 0;
+    for (int run = 0; run < runs; ++run) {
+        auto start = chrono::steady_clock::now();
+        vector<Ticket> tickets;
+        loadTicketsStream(tickets, filename);
+        streamMs = min(streamMs, elapsedMs(start));
+
+        start = chrono::steady_clock::now();
+        TicketViewSet views;
+        loadTicketViews(views, filename);
+        viewMs = min(viewMs, elapsedMs(start));
+        loaded = views.tickets.size();
+
+        start = chrono::steady_clock::now();
+        loadTickets(tickets, filename);
+        materializeMs = min(materializeMs, elapsedMs(start));
+    }
+
+    cout << "Loaded " << loaded << " rows, best of " << runs << " runs:\n";
+    cout << left << setw(28) << "loader" << right << setw(12) << "ms" << setw(12) << "ns/row" << endl;
+    auto report = [&](const string& name, double ms) {
+        cout << left << setw(28) << name << right << fixed << setprecision(1)
+             << setw(12) << ms << setw(12) << (ms * 1e6 / max<size_t>(rows, 1)) << endl;
+    };
+    report("stringstream (old)", streamMs);
+    report("mmap string_view", viewMs);
+    report("mmap + materialize Ticket", materializeMs);
+
+    remove(filename.c_str());
+}
 
-    if (it == venues.end() || it->eventName.empty()) {
-        cout << "[ERROR] Venue not found or no event assigned.\n";
-        return;
-    }
+// Runs inside a scratch directory so the real data files are never touched
+void benchPurchases() {
+    const string dir = "bench_purchase.tmp";
+    filesystem::path home = filesystem::current_path();
+    filesystem::remove_all(dir);
+    filesystem::create_directory(dir);
+    filesystem::current_path(dir);
+
+    Venue v;
+    v.venueID = "B";
+    v.eventName = "Bench Event";
+    v.rows = 1;
+    v.columns = 1;
+    v.ticketType.push_back({"Normal", 10, 1000000000, 0});
+    v.isAvailable = false;
+
+    store = DataStore();
+    store.venues.push_back(v);
+    store.loaded[VENUES] = true;
+    store.loaded[TICKETS] = true;
+    saveVenues(store.venues);
+    recoverIdCounters();
+
+    // Start every measurement from an empty log and ticket file
+    auto reset = [&]() {
+        checkpointStores();
+        store.tickets.clear();
+        rebuildTicketIndex();
+        remove("ticket.txt");
+    };
+
+    const int ticketsPerRun = 5000;
+    const int quantities[] = {1, 10, 50, 100, 500};
+    cout << "Buying " << ticketsPerRun << " tickets per run, in purchases of each quantity:\n";
+    cout << left << setw(10) << "qty" << right << setw(18) << "per-ticket us" << setw(18) << "batched us" << setw(10) << "speedup" << endl;
+    for (int qty : quantities) {
+        int purchases = ticketsPerRun / qty;
+        TicketType& tt = store.venues[0].ticketType[0];
+
+        // The old path: one log write per ticket, then the sold counter
+        reset();
+        auto start = chrono::steady_clock::now();
+        for (int p = 0; p < purchases; ++p) {
+            int firstID = allocateIds('T', qty);
+            for (int i = 0; i < qty; ++i) {
+                Ticket t;
+                t.userEmail = "bench@example.com";
+                t.eventName = v.eventName;
+                t.ticketType = tt.type;
+                t.amount = tt.price;
+                t.ticketID = formatId('T', firstID + i);
+                addStoreTicket(t);
+                saveTicket(t);
+            }
+            markDirty(TICKETS);
+            tt.sold += qty;
+            updateVenueTicketStats(0, 0, tt.sold, tt.revenue);
+        }
+        double singleMs = elapsedMs(start);
 
+        reset();
+        start = chrono::steady_clock::now();
+        for (int p = 0; p < purchases; ++p) {
+            purchaseTickets(0, 0, "bench@example.com", qty);
+        }
+        double batchMs = elapsedMs(start);
 
-    const Venue& venue = *it;
-    const string filename = venue.eventName + " Event Report.txt";
-    ofstream file(filename);
-    if (!file.is_open()) {
-        cout << "[ERROR] Unable to create report file.\n";
-        return;
+        int bought = purchases * qty;
+        cout << left << setw(10) << qty << right << fixed << setprecision(2)
+             << setw(18) << singleMs * 1000 / bought
+             << setw(18) << batchMs * 1000 / bought
+             << setw(9) << singleMs / batchMs << "x" << endl;
     }
 
-    file << "========== FINAL REPORT ==========\n";
-    file << "Event: " << venue.eventName << "\n";
-    file << "Venue: " << venue.venueID << "\n";
+    store = DataStore();
+    filesystem::current_path(home);
+    filesystem::remove_all(dir);
+}
 
-    // Tickets
-    int totalTickets = 0;
-    double totalTicketRevenue = 0.0;
-    for (const auto& t : tickets) {
-        if (t.eventName == venue.eventName) {
-            totalTickets++;
-            totalTicketRevenue += t.amount;
+// Checks that no ticket type or booth was sold beyond its stock and that
+// the venue counters agree with the ticket and booth records
+bool verifyInventory(const vector<Venue>& venues, const vector<Ticket>& tickets,
+                     const vector<Booth>& booths, string& problem) {
+    map<pair<string, string>, int> ticketCounts;
+    for (const auto& t : tickets) ticketCounts[{t.eventName, t.ticketType}]++;
+    for (const auto& v : venues) {
+        for (const auto& tt : v.ticketType) {
+            int counted = ticketCounts[{v.eventName, tt.type}];
+            if (tt.sold > tt.capacity || tt.sold != counted) {
+                problem = v.venueID + " " + tt.type + ": sold " + to_string(tt.sold) + ", capacity " +
+                          to_string(tt.capacity) + ", tickets " + to_string(counted);
+                return false;
+            }
         }
     }
-    file << "\nTicket Sales:\n";
-    file << "Total Tickets Sold : " << totalTickets << "\n";
-    file << "Total Ticket Revenue: RM " << fixed << setprecision(2) << totalTicketRevenue << "\n";
 
-    // Booths
-    int totalBooths = 0;
-    double totalBoothRevenue = 0.0;
+    set<pair<string, string>> rented;
+    map<string, int> boothCounts;
     for (const auto& b : booths) {
-        if (b.venueID == venue.venueID && b.isRented) {
-            totalBooths++;
-            totalBoothRevenue += b.amount;
+        if (!b.isRented) continue;
+        if (!rented.insert({b.venueID, b.boothID}).second) {
+            problem = "booth " + b.venueID.str() + " " + b.boothID + " rented twice";
+            return false;
         }
+        boothCounts[b.venueID]++;
     }
-    file << "\nBooth Rentals:\n";
-    file << "Total Booths Rented : " << totalBooths << "\n";
-    file << "Total Booth Revenue : RM " << fixed << setprecision(2) << totalBoothRevenue << "\n";
-
-    // Sessions
-    file << "\nSessions Summary:\n";
-    bool hasSessions = false;
-    for (const auto& s : sessions) {
-        if (s.venueID == venue.venueID) {
-            file << " - [" << s.sessionID << "] " << s.topic
-                 << " | Time: " << s.timeSlot
-                 << " | Exhibitor: " << s.exhibitorEmail << "\n";
-            hasSessions = true;
+    for (const auto& v : venues) {
+        if (v.boothsRented != boothCounts[v.venueID]) {
+            problem = v.venueID + ": " + to_string(v.boothsRented) + " booths counted, " +
+                      to_string(boothCounts[v.venueID]) + " rented";
+            return false;
         }
     }
-    if (!hasSessions) file << "No sessions scheduled.\n";
-
-    // Grand Total
-    double grandTotal = totalTicketRevenue + totalBoothRevenue;
-    file << "\nGRAND TOTAL REVENUE: RM " << fixed << setprecision(2) << grandTotal << "\n";
-    file << "========== END OF REPORT ==========\n";
+    return true;
+}
 
-    file.close();
-    cout << "[INFO] Final report for " << venue.eventName << " exported to " << filename << endl;
+struct StressRun {
+    double ms;
+    size_t attempts;
+    size_t sales;
+    bool ok;
+};
 
-    cout << "\nPress Enter to continue...\n";
-    cin.ignore();
+// One run in the current directory: fresh venues, then threadCount threads
+// buying tickets, renting booths and now and then refunding a ticket, then
+// the checks, in memory and again after a reload from disk
+StressRun runSalesStress(int threadCount, int venueCount, int attemptsPerThread, bool atomicTickets) {
+    // Stock for about two thirds of the ticket demand, so every type sells
+    // out while buyers are still racing for it
+    int capacity = max(1, int(threadCount * attemptsPerThread * 0.8 * 2.5 / (venueCount * 3) / 1.5));
 
+    store = DataStore();
+    for (int i = 0; i < venueCount; ++i) {
+        Venue v;
+        v.venueID = generatedVenueID(i);
+        v.eventName = "Stress Event " + to_string(i + 1);
+        v.rows = MAX_BOOTH_ROWS;
+        v.columns = MAX_BOOTH_COLS;
+        v.isAvailable = false;
+        layoutVenueBooths(v, 30);
+        v.ticketType = {{"Normal", 10, capacity, 0}, {"Express", 20, capacity, 0}, {"VIP", 50, capacity, 0}};
+        store.venues.push_back(v);
+    }
+    store.loaded[VENUES] = store.loaded[TICKETS] = store.loaded[BOOTHS] = true;
+    saveVenues(store.venues);
+    idCounters.clear();
+    recoverIdCounters();
+    prepareConcurrentSales(atomicTickets);
+    commitMode = COMMIT_BEFORE_REPLY; // as the server does
+
+    atomic<size_t> sales(0);
+    auto worker = [&](int id) {
+        ExpoRandom rng{uint64_t(id) + 1};
+        string email = "buyer" + to_string(id) + "@example.com";
+        for (int i = 0; i < attemptsPerThread; ++i) {
+            if (rng.below(50) == 0) {
+                // Refunds run exclusively, as in the server
+                unique_lock<shared_mutex> lock(storeMutex);
+                settleTicketInventory();
+                const vector<size_t>& mine = userTicketPositions(email);
+                double amount;
+                if (!mine.empty()) refundTicketByID(email, store.tickets[mine.back()].ticketID, amount);
+                lock.unlock();
+                commitWal();
+                continue;
+            }
+            bool sold;
+            {
+                shared_lock<shared_mutex> lock(storeMutex);
+                size_t vi = rng.below(venueCount);
+                if (rng.below(5) == 0) {
+                    string boothID = string(1, 'A' + rng.below(MAX_BOOTH_COLS)) + to_string(1 + rng.below(MAX_BOOTH_ROWS));
+                    sold = rentBooth(vi, boothID, email);
+                } else {
+                    sold = purchaseTickets(vi, rng.below(3), email, 1 + rng.below(4));
+                }
+            }
+            if (sold) sales++;
+            commitWal();
+        }
+    };
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (int t = 0; t < threadCount; ++t) pool.emplace_back(worker, t);
+    for (auto& t : pool) t.join();
+    double ms = elapsedMs(start);
+
+    endConcurrentSales();
+    commitMode = COMMIT_EACH_WRITE;
+    string problem;
+    bool ok = verifyInventory(store.venues, store.tickets, store.booths, problem);
+    if (!ok) cerr << "In memory: " << problem << "\n";
+
+    flushStore();
+    releaseIdLeases();
+    store = DataStore();
+    if (ok && !verifyInventory(storeVenues(), storeTickets(), storeBooths(), problem)) {
+        cerr << "After reload: " << problem << "\n";
+        ok = false;
+    }
+    store = DataStore();
+    return {ms, size_t(threadCount) * attemptsPerThread, sales.load(), ok};
 }
 
-void adminReportSelection() {
-    vector<Ticket> tickets; loadTickets(tickets);
-    vector<Booth> booths; loadBooths(booths);
-    vector<Session> sessions; loadSessions(sessions);
-    vector<Venue> venues; loadVenues(venues);
-
-    cout << "===========================================\n";
-    cout << "||            Reporting Menu             ||\n";
-    cout << "===========================================\n";
+// Runs in a scratch directory so the real data files are never touched
+int stressSales(int argc, char* argv[]) {
+    int threads = max(2, (int)thread::hardware_concurrency());
+    int venues = 8;
+    int attempts = 5000;
+    for (int i = 2; i < argc; ++i) {
+        string option = argv[i];
+        size_t eq = option.find('=');
+        string key = option.substr(0, eq);
+        int value = 0;
+        if (eq == string::npos || !parseIntArg(option.substr(eq + 1), value) || value < 1 ||
+            (key != "threads" && key != "venues" && key != "attempts")) {
+            cout << "Usage: --stress [threads=N] [venues=N] [attempts=N per thread]\n";
+            return 1;
+        }
+        (key == "threads" ? threads : key == "venues" ? venues : attempts) = value;
+    }
+
+    const string dir = "stress.tmp";
+    filesystem::path home = filesystem::current_path();
+    filesystem::remove_all(dir);
+    filesystem::create_directory(dir);
+    filesystem::current_path(dir);
+
+    NullBuffer sink;
+    streambuf* screen = cout.rdbuf(&sink);
+    ostream out(screen);
+
+    out << "Concurrent sales over " << venues << " venues, " << attempts << " attempts per thread:\n";
+    out << left << setw(10) << "threads" << setw(10) << "inventory" << right << setw(12) << "attempts"
+        << setw(10) << "sales" << setw(12) << "ms" << setw(14) << "attempts/s" << setw(8) << "check" << endl;
+    bool allOk = true;
+    for (int n = 1; n <= threads; n = (n * 2 > threads && n < threads) ? threads : n * 2) {
+        for (bool atomicTickets : {false, true}) {
+            for (const auto& entry : filesystem::directory_iterator(".")) filesystem::remove_all(entry.path());
+            StressRun run = runSalesStress(n, venues, attempts, atomicTickets);
+            allOk = allOk && run.ok;
+            out << left << setw(10) << n << setw(10) << (atomicTickets ? "atomic" : "striped") << right
+                << setw(12) << run.attempts << setw(10) << run.sales << fixed << setprecision(1) << setw(12)
+                << run.ms << setw(14) << setprecision(0) << run.attempts * 1000.0 / run.ms << setw(8)
+                << (run.ok ? "ok" : "FAIL") << endl;
+        }
+    }
+    out << (allOk ? "PASS: no ticket type or booth oversold\n" : "FAIL: inventory checks failed\n");
+
+    cout.rdbuf(screen);
+    filesystem::current_path(home);
+    filesystem::remove_all(dir);
+    return allOk ? 0 : 1;
+}
 
-    cout << "Available Events:\n";
-    for (const auto& v : venues) {
-        if (!v.eventName.empty())
-            cout << " - Venue " << v.venueID << ": " << v.eventName << endl;
-    }
+// purchaseTickets on one hot ticket type, as the server runs it: each
+// purchase under a shared storeMutex, then a group commit before the next.
+// Every thread buys until the type sells out; the tickets written must come
+// to exactly the capacity, in memory and after a reload. Call from a
+// scratch directory.
+double benchPurchases(int threadCount, int capacity, bool atomicTickets, bool& ok) {
+    store = DataStore();
+    Venue v;
+    v.venueID = generatedVenueID(0);
+    v.eventName = "Flash Sale";
+    v.rows = MAX_BOOTH_ROWS;
+    v.columns = MAX_BOOTH_COLS;
+    v.isAvailable = false;
+    layoutVenueBooths(v, 30);
+    v.ticketType = {{"Normal", 10, capacity, 0}};
+    store.venues.push_back(v);
+    store.loaded[VENUES] = store.loaded[TICKETS] = store.loaded[BOOTHS] = true;
+    saveVenues(store.venues);
+    idCounters.clear();
+    recoverIdCounters();
+    prepareConcurrentSales(atomicTickets);
+    commitMode = COMMIT_BEFORE_REPLY;
+
+    atomic<int> seats(0);
+    auto worker = [&](int id) {
+        ExpoRandom rng{uint64_t(id) + 1};
+        string email = "buyer" + to_string(id) + "@example.com";
+        while (seats.load() < capacity) {
+            int qty = 1 + rng.below(4);
+            bool sold;
+            {
+                shared_lock<shared_mutex> lock(storeMutex);
+                sold = purchaseTickets(0, 0, email, qty);
+            }
+            if (!sold) continue; // fewer than qty left, or none once seats catches up
+            seats += qty;
+            commitWal();
+        }
+    };
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (int t = 0; t < threadCount; ++t) pool.emplace_back(worker, t);
+    for (auto& t : pool) t.join();
+    double ms = elapsedMs(start);
+
+    endConcurrentSales();
+    commitMode = COMMIT_EACH_WRITE;
+    string problem;
+    ok = seats.load() == capacity && store.tickets.size() == size_t(capacity) &&
+         verifyInventory(store.venues, store.tickets, store.booths, problem);
+    if (!problem.empty()) cerr << "In memory: " << problem << "\n";
+
+    flushStore();
+    releaseIdLeases();
+    store = DataStore();
+    if (ok && (storeTickets().size() != size_t(capacity) ||
+               !verifyInventory(storeVenues(), storeTickets(), storeBooths(), problem))) {
+        cerr << "After reload: " << problem << "\n";
+        ok = false;
+    }
+    store = DataStore();
+    return ms;
+}
 
-    string venueID;
-    cout << "\nEnter Venue ID to generate report: ";
-    getline(cin, venueID);
-    transform(venueID.begin(), venueID.end(), venueID.begin(), ::toupper);
+// Runs in a scratch directory so the real data files are never touched
+int benchInventory(int argc, char* argv[]) {
+    int threads = max(2, (int)thread::hardware_concurrency());
+    int capacity = 20000;
+    for (int i = 2; i < argc; ++i) {
+        string option = argv[i];
+        size_t eq = option.find('=');
+        string key = option.substr(0, eq);
+        int value = 0;
+        if (eq == string::npos || !parseIntArg(option.substr(eq + 1), value) || value < 1 ||
+            (key != "threads" && key != "capacity")) {
+            cout << "Usage: --bench-inventory [threads=N] [capacity=N seats]\n";
+            return 1;
+        }
+        (key == "threads" ? threads : capacity) = value;
+    }
+
+    const string dir = "bench.tmp";
+    filesystem::path home = filesystem::current_path();
+    filesystem::remove_all(dir);
+    filesystem::create_directory(dir);
+    filesystem::current_path(dir);
+
+    NullBuffer sink;
+    streambuf* screen = cout.rdbuf(&sink);
+    ostream out(screen);
+
+    out << "purchaseTickets on " << capacity << " seats of one ticket type (" << thread::hardware_concurrency()
+        << " hardware threads):\n";
+    out << left << setw(10) << "threads" << right << setw(16) << "striped seats/s" << setw(10) << "scale"
+        << setw(16) << "atomic seats/s" << setw(10) << "scale" << setw(8) << "check" << endl;
+    double baseline[2] = {0, 0};
+    bool allOk = true;
+    for (int n = 1; n <= threads; n = (n * 2 > threads && n < threads) ? threads : n * 2) {
+        out << left << setw(10) << n << right;
+        bool ok = true;
+        for (bool atomicTickets : {false, true}) {
+            for (const auto& entry : filesystem::directory_iterator(".")) filesystem::remove_all(entry.path());
+            bool runOk = false;
+            double rate = capacity * 1000.0 / benchPurchases(n, capacity, atomicTickets, runOk);
+            if (n == 1) baseline[atomicTickets] = rate;
+            ok = ok && runOk;
+            out << fixed << setprecision(0) << setw(16) << rate << setprecision(2) << setw(9)
+                << rate / baseline[atomicTickets] << "x";
+        }
+        allOk = allOk && ok;
+        out << setw(8) << (ok ? "ok" : "FAIL") << endl;
+    }
+    out << (allOk ? "PASS: every seat sold exactly once\n" : "FAIL: seats oversold or left unsold\n");
+    // The atomic mode only takes the stripe lock off the reservation
+    out << "Both modes still serialize each purchase on idMutex, appendMutex, and\n"
+           "walMutex around opening and appending expo.wal; each buyer then waits\n"
+           "for a group commit's fsync before buying again.\n";
+
+    cout.rdbuf(screen);
+    filesystem::current_path(home);
+    filesystem::remove_all(dir);
+    return allOk ? 0 : 1;
+}
 
-    cout << "1. View Report on Screen\n";
-    cout << "2. Export Report to File\n";
-    int choice = getValidatedChoice(0, 2, "Choice (0 to return): ");
+// The regex/stoi validators the hand-written ones replaced
+bool isValidEmailRegex(const string &email) {
+    const regex pattern(R"(^[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Za-z]{2,}$)");
+    return regex_match(email, pattern);
+}
 
-    switch (choice)
-    {
-        case 1: generateEventReport(venueID, tickets, booths, sessions, venues); break;
-        case 2: exportReportToFile(venueID, tickets, booths, sessions, venues); break;
-        case 0: return;
-    }
+bool isValidTimeSlotRegex(const string& slot) {
+    regex pattern(R"(^\d{2}:\d{2}-\d{2}:\d{2}$)");
+    if (!regex_match(slot, pattern)) return false;
 
+    int sh = stoi(slot.substr(0, 2));
+    int sm = stoi(slot.substr(3, 2));
+    int eh = stoi(slot.substr(6, 2));
+    int em = stoi(slot.substr(9, 2));
 
+    if (sh < 0 || sh > 23 || eh < 0 || eh > 23) return false;
+    if (sm < 0 || sm > 59 || em < 0 || em > 59) return false;
+    return sh * 100 + sm < eh * 100 + em;
 }
-// ==========================
-// PROFILE DASHBOARD
-// ==========================
-void attendeeDashboard(Attendee &a, vector<Announcement> &annc, vector<UserCredential> &credentials) {
-    while (true) {
-        cout << "\n=====================================================\n";
-        cout << "||               Attendee Dashboard                ||\n";
-        cout << "=====================================================\n";
-        cout << "|| 1. View Profile                                 ||\n";
-        cout << "|| 2. Update Profile                               ||\n";
-        cout << "|| 3. Delete Account                               ||\n";
-        cout << "|| 4. View Event Announcements                     ||\n";
-        cout << "|| 5. Purchase Tickets                             ||\n";
-        cout << "|| 6. Manage Purchased Tickets                     ||\n";
-        cout << "|| 7. Submit Feedbacks                             ||\n";
-        cout << "|| 8. View Available Sessions                      ||\n";
-        cout << "|| 0. Logout                                       ||\n";
-        cout << "=====================================================\n";
-        cout << "Choice: ";
-
-        string choice;
-        getline(cin, choice);
 
-        if (choice == "1") { // View Profile
-            viewAttendeeProfile(a);
-            cout << "Press Enter to return to dashboard...";
-            cin.ignore();
-        }
-        else if (choice == "2") { // Update Profile
-            updateAttendeeProfile(a, credentials);
-            
-        }
-        else if (choice == "3") { // Delete Profile
-            deleteAttendeeProfile(a);
-            break;
-            
-        }
-        else if (choice == "4") { // View Announcement
-            viewAnnouncement(annc, "Attendee");
-        }
-        else if (choice == "5") { // Purchase Ticket
-            vector<Venue> venues; loadVenues(venues);
-            vector<Ticket> tickets; loadTickets(tickets);
-            purchaseTicket(venues, tickets, a.email);
+bool isValidBoothIDStoi(const Venue& venue, const string& boothID) {
+    if (boothID.length() < 2 || !isDigits(boothID.substr(1))) {
+        return false;
+    }
+    char col = toupper(boothID[0]);
+    int row = 0;
+    try { row = stoi(boothID.substr(1)); } catch (...) { return false; }
+    if (col < 'A' || col >= 'A' + venue.columns) return false;
+    if (row < 1 || row > venue.rows) return false;
+    return true;
+}
 
-        }
-        else if (choice == "6") { // Manage Ticket
-            attendeeTicketSelection(a.email);
-        }
-        else if (choice == "7") { // Submit Feedbacks
-            vector<Ticket> tickets; loadTickets(tickets);
-            submitFeedback(a.email, tickets);
+// Times both paths over the same mixed inputs and checks they always agree
+int benchValidators(size_t calls) {
+    const vector<string> emails = {
+        "alice@example.com", "bob.smith+expo@mail.co.uk", "x@y.io", "UPPER_case%1@Host-9.ORG",
+        "", "@example.com", "alice@", "alice@example", "alice@example.c", "alice@.com",
+        "alice@@example.com", "ali ce@example.com", "alice@exa_mple.com", "alice@example.c0m",
+        "alice@example.com.", "a@b.cd.ef", "a@-.xy", "a@b..cd", "alice@example.com\n"};
+    const vector<string> slots = {
+        "09:00-10:30", "00:00-23:59", "13:15-13:16", "10:00-09:00", "10:00-10:00",
+        "24:00-25:00", "09:60-10:00", "9:00-10:00", "09:00 10:00", "09:00-10:0a",
+        "", "09:00-10:00x", "ab:cd-ef:gh", "23:58-23:59"};
+    const vector<string> booths = {
+        "A1", "c3", "D4", "B10", "E1", "A0", "A", "1A", "A-1", "A1x", "AA1", "", "Z9",
+        "A0004", "a04", "A99999999999", "A0000001", "B00000000000004", "A2147483647", "A2147483648"};
+    Venue venue;
+    venue.rows = 4;
+    venue.columns = 4;
+
+    size_t mismatches = 0;
+    for (const string& e : emails) if (isValidEmail(e) != isValidEmailRegex(e)) {
+        cout << "email mismatch: \"" << e << "\"\n";
+        mismatches++;
+    }
+    for (const string& t : slots) if (isValidTimeSlot(t) != isValidTimeSlotRegex(t)) {
+        cout << "time slot mismatch: \"" << t << "\"\n";
+        mismatches++;
+    }
+    for (const string& b : booths) if (isValidBoothID(venue, b) != isValidBoothIDStoi(venue, b)) {
+        cout << "booth ID mismatch: \"" << b << "\"\n";
+        mismatches++;
+    }
+
+    cout << "Validating " << calls << " inputs per row:\n";
+    cout << left << setw(12) << "validator" << right << setw(14) << "regex ns" << setw(14) << "hand ns" << setw(10) << "speedup" << endl;
+    auto run = [&](const string& name, const vector<string>& inputs, auto oldPath, auto newPath) {
+        volatile size_t accepted = 0;
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < calls; ++i) accepted = accepted + oldPath(inputs[i % inputs.size()]);
+        double oldMs = elapsedMs(start);
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < calls; ++i) accepted = accepted + newPath(inputs[i % inputs.size()]);
+        double newMs = elapsedMs(start);
+        cout << left << setw(12) << name << right << fixed << setprecision(1)
+             << setw(14) << oldMs * 1e6 / calls << setw(14) << newMs * 1e6 / calls
+             << setw(9) << oldMs / newMs << "x" << endl;
+    };
+    run("email", emails, [](const string& e) { return isValidEmailRegex(e); },
+        [](const string& e) { return isValidEmail(e); });
+    run("time slot", slots, [](const string& t) { return isValidTimeSlotRegex(t); },
+        [](const string& t) { return isValidTimeSlot(t); });
+    run("booth ID", booths, [&](const string& b) { return isValidBoothIDStoi(venue, b); },
+        [&](const string& b) { return isValidBoothID(venue, b); });
+
+    cout << (mismatches ? "FAIL: " + to_string(mismatches) + " inputs disagree\n" : "PASS: all inputs agree\n");
+    return mismatches ? 1 : 0;
+}
 
-        }
-        else if (choice == "8") { // View Sessions
-            viewSessionsByAttendee(a.email);
-        }
-        else if (choice == "0") {
-            cout << "Logging out...\n";
-            break;
-        } else cout << "Invalid choice.\n";
-    }
+// Bench builds (-DEXPO_BENCH) count every operator new so the suite can
+// report allocations per op. The default build keeps the plain allocator:
+// a shared counter would be contended by every sales thread.
+atomic<size_t> allocCount{0};
+atomic<size_t> allocBytes{0};
+
+#ifdef EXPO_BENCH
+const bool allocationsCounted = true;
+
+void* operator new(size_t size) {
+    allocCount.fetch_add(1, memory_order_relaxed);
+    allocBytes.fetch_add(size, memory_order_relaxed);
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
 }
 
-void exhibitorDashboard(Exhibitor &e, vector<Announcement> &annc, vector<UserCredential> &credentials) {
+// Kept out of line: once inlined, GCC pairs the free with operator new and warns
+[[gnu::noinline]] void operator delete(void* p) noexcept { free(p); }
+[[gnu::noinline]] void operator delete(void* p, size_t) noexcept { free(p); }
+#else
+const bool allocationsCounted = false;
+#endif
+
+// The modes that report allocations only run in a bench build
+bool requireBenchBuild(const string& mode) {
+    if (allocationsCounted) return true;
+    cout << mode << " reports allocations; rebuild with -DEXPO_BENCH to run it.\n";
+    return false;
+}
+
+struct BenchResult {
+    string name;
+    size_t tickets;    // dataset size the case ran against
+    size_t iterations;
+    double nsPerOp;
+    double bytesPerOp;
+    double allocsPerOp;
+};
+
+// Runs op in doubling batches until one batch takes at least 100 ms and
+// reports that batch. The first call is a warm-up and is not counted.
+BenchResult runBenchCase(const string& name, size_t tickets, const function<void()>& op) {
+    op();
+    size_t batch = 1;
     while (true) {
-        cout << "\n=====================================================\n";
-        cout << "||               Exhibitor Dashboard               ||\n";
-        cout << "=====================================================\n";
-        cout << "|| 1. View Profile                                 ||\n";
-        cout << "|| 2. Update Profile                               ||\n";
-        cout << "|| 3. Delete Account                               ||\n";
-        cout << "|| 4. View Event Announcements                     ||\n";
-        cout << "|| 5. Book Booths                                  ||\n";
-        cout << "|| 6. Manage Booked Booths                         ||\n";
-        cout << "|| 7. Schedule Sessions                            ||\n";
-        cout << "|| 8. Manage Sessions Scheduled                    ||\n";
-        cout << "|| 9. Monitor Booth/Session Stats                  ||\n";
-        cout << "|| 0. Logout                                       ||\n";
-        cout << "=====================================================\n";
-        cout << "Choice: ";
+        size_t allocs = allocCount.load(), bytes = allocBytes.load();
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < batch; ++i) op();
+        double ms = elapsedMs(start);
+        if (ms >= 100 || batch >= (size_t(1) << 24)) {
+            cerr << "  " << left << setw(28) << name << right << fixed << setprecision(0)
+                 << setw(14) << ms * 1e6 / batch << " ns/op\n";
+            return {name, tickets, batch, ms * 1e6 / batch,
+                    double(allocBytes.load() - bytes) / batch, double(allocCount.load() - allocs) / batch};
+        }
+        batch *= 2;
+    }
+}
 
-        string choice;
-        getline(cin, choice);
+// The other collections grow with the ticket count
+GeneratorConfig scaledDataset(size_t tickets, uint64_t seed) {
+    GeneratorConfig config;
+    config.dir = to_string(tickets);
+    config.seed = seed;
+    config.tickets = tickets;
+    config.venues = (int)max<size_t>(4, min<size_t>(2000, tickets / 5000));
+    config.attendees = (int)max<size_t>(10, tickets / 20);
+    config.exhibitors = (int)max<size_t>(4, tickets / 500);
+    config.feedback = tickets / 10;
+    return config;
+}
 
-        if (choice == "1") { // View Profile
-            viewExhibitorProfile(e);
-            cout << "Press Enter to return to dashboard...";
-            cin.ignore();
-        }
-        else if (choice == "2") { // Update Profile
-            updateExhibitorProfile(e, credentials);
+void benchPersistenceAt(size_t tickets, uint64_t seed, vector<BenchResult>& results) {
+    GeneratorConfig config = scaledDataset(tickets, seed);
 
-        }
-        else if (choice == "3") { // Delete Profile
-            deleteExhibitorProfile(e);
-            break;
+    // stdout carries only the results, so the app's own messages are dropped
+    NullBuffer sink;
+    streambuf* screen = cout.rdbuf(&sink);
+    generateDataset(config);
+    filesystem::current_path(config.dir);
 
-        }
-        else if (choice == "4") { // View Announcement
-            viewAnnouncement(annc, "Exhibitor");
-        }
-        else if (choice == "5") { // Book Booth
-            vector<Venue> venues; loadVenues(venues);
-            vector<Booth> booths; loadBooths(booths);
-            bookBooth(venues, booths, e.email);
-        }
-        else if (choice == "6") { // Manage Booth
-            exhibitorBoothSelection(e.email); 
-        }
-        else if (choice == "7") { // Schedule Session
-            scheduleSession(e.email);
-        }
-        else if (choice == "8") { // Manage Session
-            ExhibitorSessionSelection(e.email);
-        }
-        else if (choice == "9") { // Monitor Stats
-            monitorExhibitorStats(e.email);
-        }
-        else if (choice == "0") {
-            cout << "Logging out...\n";
-            break;
-        } else cout << "Invalid choice.\n";
+    store = DataStore();
+    idCounters.clear();
+    recoverStores();
+    recoverIdCounters();
+    cerr << "Dataset with " << tickets << " tickets:\n";
+
+    auto add = [&](const string& name, const function<void()>& op) {
+        results.push_back(runBenchCase(name, tickets, op));
+    };
+
+    add("loadTickets", [] { vector<Ticket> t; loadTickets(t); });
+    add("loadBooths", [] { vector<Booth> b; loadBooths(b); });
+    add("loadVenues", [] { vector<Venue> v; loadVenues(v); });
+    add("loadSessions", [] { vector<Session> s; loadSessions(s); });
+    add("loadFeedbacks", [] { vector<Feedback> f = loadFeedbacks(); });
+    add("loadCredentials", [] { vector<UserCredential> c; loadCredentials(c); });
+
+    vector<Venue>& venues = storeVenues();
+    add("saveVenues", [&] { saveVenues(venues); });
+
+    // Sessions are saved by a checkpoint rewriting the whole file from memory
+    vector<Session>& sessions = storeSessions();
+    if (!sessions.empty()) {
+        string line = sessionLine(sessions[0]);
+        add("saveSessions (checkpoint)", [&] { walReplace("sessions.txt", line, line); checkpointStores(); });
     }
-}
 
-void adminDashboard(Admin &ad, vector<Announcement> &annc, vector<UserCredential> &credentials) {
+    add("allocateId (ticket ID)", [] { allocateId('T'); });
 
-    while (true) {
-        cout << "\n=====================================================\n";
-        cout << "||                 Admin Dashboard                 ||\n";
-        cout << "=====================================================\n";
-        cout << "|| 1. View Profile                                 ||\n"; 
-        cout << "|| 2. Update Profile                               ||\n"; 
-        cout << "|| 3. Manage Event Announcements                   ||\n"; 
-        cout << "|| 4. Manage Event Venues                          ||\n";
-        cout << "|| 5. View Sessions                                ||\n"; 
-        cout << "|| 6. Manage Feedbacks                             ||\n"; 
-        cout << "|| 7. Monitor Ticket/Booth/Session Stats           ||\n"; 
-        cout << "|| 8. Manage Reports                               ||\n"; 
-        cout << "|| 0. Logout                                       ||\n";
-        cout << "=====================================================\n";
-        cout << "Choice: ";
+    add("displayBoothLayout", [&] { displayBoothLayout(venues[0]); });
 
-        string choice;
-        getline(cin, choice);
+    flushStore();
+    releaseIdLeases();
+    cout.rdbuf(screen);
+    store = DataStore();
+    idCounters.clear();
+    filesystem::current_path("..");
+}
 
-        if (choice == "1") { // View Profile
-            viewAdminProfile(ad);
-            cout << "Press Enter to return to dashboard...";
-            cin.ignore();
-        }
-        else if (choice == "2") { // Update Profile
-            updateAdminProfile(ad, credentials);
-        }
-        else if (choice == "3") { // Manage Announcement
-            adminAnnouncementSelection(annc);
-        }
-        else if (choice == "4") { // Manage Event Venues
-            adminEventSelection();
-        }
-        else if (choice == "5") { // View Sessions
-            viewAllSessions();
-        }
-        else if (choice == "6") { // Manage Feedbacks
-            adminFeedbackSelection();
-        }
-        else if (choice == "7") { // Monitor Stats
-            monitorAdminStats();
-        }
-        else if (choice == "8") { // Manage Report
-            adminReportSelection();
+void writeBenchResults(ostream& out, const vector<BenchResult>& results, bool csv) {
+    out << fixed << setprecision(1);
+    if (csv) {
+        out << "name,tickets,iterations,ns_per_op,bytes_per_op,allocs_per_op\n";
+        for (const auto& r : results) {
+            out << r.name << "," << r.tickets << "," << r.iterations << "," << r.nsPerOp << ","
+                << r.bytesPerOp << "," << r.allocsPerOp << "\n";
         }
-        else if (choice == "0") {
-            cout << "Logging out...\n";
-            break;
-        } else cout << "Invalid choice.\n";
+        return;
     }
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"tickets\": " << r.tickets
+            << ", \"iterations\": " << r.iterations << ", \"ns_per_op\": " << r.nsPerOp
+            << ", \"bytes_per_op\": " << r.bytesPerOp << ", \"allocs_per_op\": " << r.allocsPerOp
+            << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
 }
 
-// ==========================
-// MENUS
-// ==========================
-void mainLogo() {
-    cout << "============================================================\n";
-    cout << "||                                                        ||\n";
-    cout << "||          _____                    _____                ||\n";
-    cout << "||         /\\    \\                  /\\    \\               ||\n";
-    cout << "||        /::\\    \\                /::\\____\\              ||\n";
-    cout << "||       /::::\\    \\              /:::/    /              ||\n";
-    cout << "||      /::::::\\    \\            /:::/    /               ||\n";
-    cout << "||     /:::/\\:::\\    \\          /:::/    /                ||\n";
-    cout << "||    /:::/  \\:::\\    \\        /:::/____/                 ||\n";
-    cout << "||   /:::/    \\:::\\    \\       ||::|    |                 ||\n";
-    cout << "||  /:::/    / \\:::\\    \\      ||::|    |     _____       ||\n";
-    cout << "|| /:::/    /   \\:::\\    \\     ||::|    |    /\\    \\      ||\n";
-    cout << "||/:::/____/     \\:::\\____\\    ||::|    |   /:::\\____\\    ||\n";
-    cout << "||\\:::\\    \\      \\::/    /    ||::|    |  /:::/    /     ||\n";
-    cout << "|| \\:::\\    \\      \\/____/     ||::|    | /:::/    /      ||\n";
-    cout << "||  \\:::\\    \\                 ||::|____|/:::/    /       ||\n";
-    cout << "||   \\:::\\    \\                ||:::::::::::/    /        ||\n";
-    cout << "||    \\:::\\    \\               \\::::::::::/____/          ||\n";
-    cout << "||     \\:::\\    \\               ~~~~~~~~~~                ||\n";
-    cout << "||      \\:::\\    \\                                        ||\n";
-    cout << "||       \\:::\\____\\                                       ||\n";
-    cout << "||        \\::/    /                                       ||\n";
-    cout << "||         \\/____/                                        ||\n";
-    cout << "||                                                        ||\n";
-    cout << "============================================================\n";
-    cout << "||                       WELCOME TO                       ||\n";
-    cout << "||              EXPO EVENT MANAGEMENT SYSTEM              ||\n";
-    cout << "============================================================\n\n";
+// Each dataset is generated into a scratch directory so the real data files
+// are never touched. Progress goes to stderr, results to stdout or out=file.
+int benchPersistence(int argc, char* argv[]) {
+    vector<size_t> sizes = {10000, 100000, 1000000};
+    uint64_t seed = 1;
+    bool csv = false;
+    string outFile;
+    for (int i = 2; i < argc; ++i) {
+        string option = argv[i];
+        size_t eq = option.find('=');
+        string key = option.substr(0, eq);
+        string value = (eq == string::npos) ? "" : option.substr(eq + 1);
+        try {
+            if (key == "sizes") {
+                sizes.clear();
+                stringstream ss(value);
+                string size;
+                while (getline(ss, size, ',')) sizes.push_back(stoull(size));
+            }
+            else if (key == "seed") seed = stoull(value);
+            else if (key == "format" && (value == "json" || value == "csv")) csv = (value == "csv");
+            else if (key == "out" && !value.empty()) outFile = value;
+            else throw invalid_argument(option);
+        } catch (...) {
+            cout << "Usage: --bench-suite [sizes=N,N,...] [seed=N] [format=json|csv] [out=file]\n";
+            return 1;
+        }
+    }
 
-}
+    const string dir = "bench_suite.tmp";
+    filesystem::path home = filesystem::current_path();
+    filesystem::remove_all(dir);
+    filesystem::create_directory(dir);
+    filesystem::current_path(dir);
 
-void mainMenu() {
-    vector<UserCredential> credentials;
-    vector<Announcement> announcements;
+    vector<BenchResult> results;
+    for (size_t tickets : sizes) benchPersistenceAt(tickets, seed, results);
 
-    while (true) {
-        loadCredentials(credentials);
-        loadAnnouncements(announcements);
+    filesystem::current_path(home);
+    filesystem::remove_all(dir);
 
-        mainLogo();
-        cout << "============================================================\n";
-        cout << "|| Please select one of the options below for logins:     ||\n";
-        cout << "============================================================\n";
-        cout << "|| 1. Attendee Login                                      ||\n";
-        cout << "|| 2. Exhibitor Login                                     ||\n";
-        cout << "|| 3. Admin Login                                         ||\n";
-        cout << "|| 4. Sign Up                                             ||\n";
-        cout << "|| 0. Exit                                                ||\n";
-        cout << "============================================================\n";
-        cout << "Choice: ";
+    if (outFile.empty()) {
+        writeBenchResults(cout, results, csv);
+    } else {
+        ofstream out(outFile, ios::trunc);
+        writeBenchResults(out, results, csv);
+        cerr << "Results written to " << outFile << "\n";
+    }
+    return 0;
+}
 
-        string choice; getline(cin, choice);
-        cout << endl;
+// Drops a file's pages from the OS cache, so the next read of it comes
+// from the disk. Only clean pages can be dropped, hence the sync.
+void evictFromCache(const string& filename) {
+#if !defined(_WIN32) && defined(POSIX_FADV_DONTNEED)
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+#endif
+}
 
-        if (choice == "1") {
-            string attendeeEmail = login(credentials, "Attendee");
-            if(attendeeEmail != "") {
-                Attendee attendee = findAttendee(attendeeEmail);
-                attendeeDashboard(attendee, announcements, credentials);
+void evictDirectoryFromCache() {
+    for (const auto& entry : filesystem::directory_iterator(".")) {
+        if (entry.is_regular_file()) evictFromCache(entry.path().string());
+    }
+}
 
-            }
+// From an empty store to every collection resident, as a fresh start would
+double timeColdStart() {
+    evictDirectoryFromCache();
+    store = DataStore();
+    auto start = chrono::steady_clock::now();
+    recoverStores();
+    for (int c = 0; c < COLLECTION_COUNT; ++c) ensureLoaded(Collection(c));
+    return elapsedMs(start);
+}
 
-        } else if (choice == "2")  {
-            string exhibitorEmail = login(credentials, "Exhibitor");
-            if(exhibitorEmail != "") {
-                Exhibitor exhibitor = findExhibitor(exhibitorEmail);
-                exhibitorDashboard(exhibitor, announcements, credentials);
+double fileMegabytes(const vector<string>& files) {
+    uintmax_t bytes = 0;
+    for (const auto& filename : files) {
+        error_code error;
+        uintmax_t size = filesystem::file_size(filename, error);
+        if (!error) bytes += size;
+    }
+    return bytes / 1048576.0;
+}
 
-            }
+// One dataset: a start from the text files, from the snapshots, and from
+// the snapshots plus a log tail of the kind a crash leaves behind. Returns
+// whether every start loaded the same data.
+bool benchStartupAt(size_t tickets, uint64_t seed) {
+    GeneratorConfig config = scaledDataset(tickets, seed);
+    NullBuffer sink;
+    streambuf* screen = cout.rdbuf(&sink);
+    generateDataset(config);
+    filesystem::current_path(config.dir);
+
+    vector<string> textFiles, snapshotFiles;
+    for (int c = 0; c < COLLECTION_COUNT; ++c) {
+        if (snapshotFile(Collection(c)).empty()) continue;
+        for (const auto& filename : collectionFiles(Collection(c))) textFiles.push_back(filename);
+        snapshotFiles.push_back(snapshotFile(Collection(c)));
+    }
+
+    double textMs = timeColdStart();
+    flushStore(); // writes the snapshots
+    double snapshotMs = timeColdStart();
+
+    // The floor: reading the snapshot bytes and nothing else
+    evictDirectoryFromCache();
+    auto start = chrono::steady_clock::now();
+    for (const auto& filename : snapshotFiles) {
+        ifstream file(filename, ios::binary);
+        string bytes((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    }
+    double readMs = elapsedMs(start);
+
+    // Refunds and new purchases since the snapshot, kept under the
+    // compaction thresholds so they stay in the log
+    vector<WalRecord> tail;
+    size_t refunds = min<size_t>(200, store.tickets.size() / 10);
+    for (size_t i = 0; i < refunds; ++i) {
+        tail.push_back({'D', "ticket.txt", ticketLine(store.tickets[i * (store.tickets.size() / refunds)])});
+    }
+    for (size_t i = 0; i < 1000 && !store.tickets.empty(); ++i) {
+        Ticket t = store.tickets[i % store.tickets.size()];
+        t.ticketID = "TAIL" + to_string(i);
+        tail.push_back({'A', "ticket.txt", ticketLine(t)});
+    }
+    walWrite(tail);
+    double tailMs = timeColdStart();
+
+    // The snapshot path must arrive at what the text files say
+    vector<Ticket> fromText;
+    loadTickets(fromText);
+    bool same = fromText.size() == store.tickets.size();
+    for (size_t i = 0; same && i < fromText.size(); ++i) same = ticketLine(fromText[i]) == ticketLine(store.tickets[i]);
+
+    double textMB = fileMegabytes(textFiles);
+    double snapshotMB = fileMegabytes(snapshotFiles);
+    flushStore();
+    cout.rdbuf(screen);
+    store = DataStore();
+    filesystem::current_path("..");
+
+    cout << left << setw(10) << tickets << right << fixed << setprecision(1)
+         << setw(9) << textMB << setw(9) << snapshotMB
+         << setw(10) << textMs << setw(10) << snapshotMs << setw(10) << tailMs << setw(10) << readMs
+         << setw(9) << textMs / snapshotMs << "x" << setw(11) << snapshotMB / (snapshotMs / 1000)
+         << "   " << (same ? "ok" : "FAIL") << endl;
+    return same;
+}
 
-        } else if (choice == "3") {
-            string adminEmail = login(credentials, "Admin");
-            if(adminEmail != "") {
-                Admin admin = findAdmin(adminEmail);
-                adminDashboard(admin, announcements, credentials);
+// Runs in a scratch directory so the real data files are never touched
+int benchStartup(int argc, char* argv[]) {
+    vector<size_t> sizes = {10000, 100000, 1000000};
+    uint64_t seed = 1;
+    for (int i = 2; i < argc; ++i) {
+        string option = argv[i];
+        size_t eq = option.find('=');
+        string key = option.substr(0, eq);
+        string value = (eq == string::npos) ? "" : option.substr(eq + 1);
+        try {
+            if (key == "sizes") {
+                sizes.clear();
+                stringstream ss(value);
+                string size;
+                while (getline(ss, size, ',')) sizes.push_back(stoull(size));
             }
-
-        }else if (choice == "4") signUp(credentials);
-        else if (choice == "0") {
-            cout << "============================================================\n";
-            cout << "||     Exiting... Thank you for using the system!         ||\n";
-            cout << "============================================================\n";
-            break;
-        }
-        else {
-            cout << "============================================================\n";
-            cout << "||          Invalid Choice, please try again!             ||\n";
-            cout << "============================================================\n";
+            else if (key == "seed") seed = stoull(value);
+            else throw invalid_argument(option);
+        } catch (...) {
+            cout << "Usage: --bench-startup [sizes=N,N,...] [seed=N]\n";
+            return 1;
         }
     }
+
+    const string dir = "bench_startup.tmp";
+    filesystem::path home = filesystem::current_path();
+    filesystem::remove_all(dir);
+    filesystem::create_directory(dir);
+    filesystem::current_path(dir);
+
+    cout << "Cold start to every collection resident, OS cache dropped before each run:\n";
+    cout << left << setw(10) << "tickets" << right << setw(9) << "text MB" << setw(9) << "snap MB"
+         << setw(10) << "text ms" << setw(10) << "snap ms" << setw(10) << "+tail ms" << setw(10) << "read ms"
+         << setw(10) << "speedup" << setw(11) << "snap MB/s" << "   check" << endl;
+    bool allOk = true;
+    for (size_t tickets : sizes) allOk = benchStartupAt(tickets, seed) && allOk;
+    cout << (allOk ? "PASS: every start loaded the same data\n" : "FAIL: a start loaded different data\n");
+
+    filesystem::current_path(home);
+    filesystem::remove_all(dir);
+    return allOk ? 0 : 1;
+}
+
+// A ticket as it was stored before interning, for the memory benchmark
+struct TextTicket {
+    string userEmail;
+    string ticketID;
+    string eventName;
+    string ticketType;
+    double amount;
+};
+
+// Heap bytes come from the bench build's counting operator new, so each layout is
+// measured as what building it allocates; the interned count includes the
+// symbol table, which starts empty in this mode.
+void benchTicketMemory(size_t rows) {
+    const string filename = "bench_ticket.txt";
+    cout << "Writing " << rows << " ticket rows to " << filename << "...\n";
+    writeBenchTicketFile(filename, rows);
+    TicketViewSet views;
+    loadTicketViews(views, filename);
+
+    size_t bytes = allocBytes.load();
+    vector<TextTicket> text;
+    text.reserve(views.tickets.size());
+    for (const auto& v : views.tickets) {
+        text.push_back({string(v.userEmail), string(v.ticketID), string(v.eventName), string(v.ticketType), v.amount});
+    }
+    size_t textBytes = allocBytes.load() - bytes;
+
+    bytes = allocBytes.load();
+    vector<Ticket> interned;
+    interned.reserve(views.tickets.size());
+    for (const auto& v : views.tickets) {
+        interned.push_back({Symbol(v.userEmail), string(v.ticketID), Symbol(v.eventName), Symbol(v.ticketType), v.amount});
+    }
+    size_t internedBytes = allocBytes.load() - bytes;
+
+    // The scans closeEvent and the reports make: every ticket of one event,
+    // then every ticket of one user, best of three
+    const string event = "Bench Event 3", user = "user42@example.com";
+    auto scan = [](auto& tickets, const auto& eventKey, const auto& userKey, size_t& matches) {
+        double best = 1e300;
+        for (int run = 0; run < 3; ++run) {
+            auto start = chrono::steady_clock::now();
+            matches = 0;
+            for (const auto& t : tickets) matches += (t.eventName == eventKey) + (t.userEmail == userKey);
+            best = min(best, elapsedMs(start));
+        }
+        return best;
+    };
+    size_t textMatches, internedMatches;
+    double textMs = scan(text, event, user, textMatches);
+    double internedMs = scan(interned, Symbol::existing(event), Symbol::existing(user), internedMatches);
+
+    size_t n = max<size_t>(rows, 1);
+    cout << "Tickets in memory, " << symbols.size() << " distinct interned values:\n";
+    cout << left << setw(12) << "layout" << right << setw(10) << "record B" << setw(12) << "heap MB"
+         << setw(14) << "bytes/ticket" << setw(12) << "scan ms" << setw(12) << "ns/ticket" << "   check" << endl;
+    auto report = [&](const string& name, size_t record, size_t heap, double ms) {
+        cout << left << setw(12) << name << right << setw(10) << record << fixed << setprecision(1)
+             << setw(12) << heap / 1048576.0 << setw(14) << double(heap) / n << setw(12) << ms
+             << setw(12) << ms * 1e6 / n << "   " << (textMatches == internedMatches ? "ok" : "FAIL") << endl;
+    };
+    report("strings", sizeof(TextTicket), textBytes, textMs);
+    report("interned", sizeof(Ticket), internedBytes, internedMs);
+    cout << "Interned tickets take " << fixed << setprecision(1) << double(textBytes) / max<size_t>(internedBytes, 1)
+         << "x less memory\n";
+
+    remove(filename.c_str());
 }
 
 // ==========================
 // ENTRY POINT
 // ==========================
-int main() {
+int main(int argc, char* argv[]) {
+    const char* windowEnv = getenv("EXPO_COMMIT_WINDOW_MS");
+    double windowMs = 0;
+    if (windowEnv && parseDoubleArg(windowEnv, windowMs) && windowMs >= 0) {
+        commitWindow = chrono::microseconds(int64_t(windowMs * 1000));
+    }
+
+    if (argc > 1 && string(argv[1]) == "--bench-tickets") {
+        size_t rows = (argc > 2) ? stoul(argv[2]) : 1000000;
+        benchTicketLoaders(rows);
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--bench-memory") {
+        if (!requireBenchBuild("--bench-memory")) return 1;
+        size_t rows = (argc > 2) ? stoul(argv[2]) : 1000000;
+        benchTicketMemory(rows);
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--bench-purchase") {
+        benchPurchases();
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--generate") {
+        GeneratorConfig config;
+        for (int i = 2; i < argc; ++i) {
+            if (!parseGeneratorOption(config, argv[i])) {
+                cout << "Unknown generator option: " << argv[i] << "\n";
+                config.venues = 0;
+                break;
+            }
+        }
+        if (!validGeneratorConfig(config)) {
+            cout << "Usage: --generate [dir] [seed=N] [venues=N] [grid=RxC] [types=N] [tickets=N]\n"
+                 << "       [attendees=N] [exhibitors=N] [admins=N] [booth-fill=P] [ticket-refunds=P]\n"
+                 << "       [booth-refunds=P] [sessions=N] [feedback=N] [announcements=N]\n"
+                 << "Grids are at most " << MAX_BOOTH_ROWS << "x" << MAX_BOOTH_COLS
+                 << " and venues have at most " << MAX_TICKET_TYPES << " ticket types.\n";
+            return 1;
+        }
+        generateDataset(config);
+        return 0;
+    }
+    if (argc > 1 && string(argv[1]) == "--bench-suite") {
+        if (!requireBenchBuild("--bench-suite")) return 1;
+        return benchPersistence(argc, argv);
+    }
+    if (argc > 1 && string(argv[1]) == "--bench-startup") {
+        return benchStartup(argc, argv);
+    }
+    if (argc > 1 && string(argv[1]) == "--batch") {
+        if (argc != 3) {
+            cout << "Usage: --batch <commands file, or - for stdin>\n";
+            return 1;
+        }
+        return runBatch(argv[2]);
+    }
+    if (argc > 1 && string(argv[1]) == "--serve") {
+        // --serve [sock] [inventory=atomic|striped]
+        string inventory = argc > 3 ? argv[3] : "inventory=striped";
+        if (inventory != "inventory=atomic" && inventory != "inventory=striped") {
+            cout << "Usage: --serve [socket path] [inventory=atomic|striped]\n";
+            return 1;
+        }
+        return runServer(argc > 2 ? argv[2] : "expo.sock", inventory == "inventory=atomic");
+    }
+    if (argc > 1 && string(argv[1]) == "--client") {
+        return runClient(argc > 2 ? argv[2] : "expo.sock", argc > 3 ? argv[3] : "");
+    }
+    if (argc > 1 && string(argv[1]) == "--stress") {
+        return stressSales(argc, argv);
+    }
+    if (argc > 1 && string(argv[1]) == "--bench-inventory") {
+        return benchInventory(argc, argv);
+    }
+    if (argc > 1 && string(argv[1]) == "--bench-validators") {
+        size_t calls = (argc > 2) ? stoul(argv[2]) : 200000;
+        return benchValidators(calls);
+    }
+
+    // EXPO_STATS=1 records from startup and prints the table on exit
+    const char* statsEnv = getenv("EXPO_STATS");
+    bool dumpStats = statsEnv && *statsEnv && string(statsEnv) != "0";
+    statsEnabled = dumpStats;
+
+    recoverStores();
+    recoverIdCounters();
     mainMenu();
+    flushStore();
+    releaseIdLeases();
+
+    if (dumpStats) {
+        cerr << "\n";
+        printStats(cerr);
+    }
     
     return 0;
 }